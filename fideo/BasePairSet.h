@@ -0,0 +1,157 @@
+/*
+ * @file     BasePairSet.h
+ * @brief    Provides the base pair set of a structure for fast comparisons.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing class BasePairSet.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#ifndef BASE_PAIR_SET_H
+#define BASE_PAIR_SET_H
+
+#include <vector>
+#include <stdint.h>
+#include <biopp/biopp.h>
+
+namespace fideo
+{
+
+/** @brief Base pairs of a secondary structure, laid out for fast comparisons
+ *
+ * Keeps the partner of each position, unpaired positions being their own
+ * partner, and a bitset of the paired positions. The exact base pair
+ * distance is a branch free pass over the partners; the bitsets give a
+ * lower bound of it with a popcount per 64 positions (the instruction
+ * when the processor has it, checked at run time), cheap enough to
+ * discard pairs of structures before any expensive comparison.
+ */
+class BasePairSet
+{
+public:
+
+    /** @brief Represent the paired positions bitset
+     *
+     */
+    typedef std::vector<uint64_t> Words;
+
+    /** @brief Constructor of class
+     *
+     */
+    BasePairSet();
+
+    /** @brief Constructor of class
+     *
+     * @param structure: structure whose pairs are taken
+     */
+    explicit BasePairSet(const biopp::SecStructure& structure);
+
+    /** @brief Take the pairs of a structure, reusing the buffers
+     *
+     * @param structure: structure whose pairs are taken
+     * @return void
+     */
+    void assign(const biopp::SecStructure& structure);
+
+    /** @brief Amount of positions of the structure
+     *
+     */
+    size_t size() const
+    {
+        return _partners.size();
+    }
+
+    /** @brief Amount of base pairs of the structure
+     *
+     */
+    size_t pairs() const
+    {
+        return _pairs;
+    }
+
+    /** @brief Amount of pairs present in both structures
+     *
+     * @param other: pairs of another structure, of any size
+     * @return pairs in common
+     */
+    size_t common(const BasePairSet& other) const;
+
+    /** @brief Base pair distance
+     *
+     * @param other: pairs of another structure, of any size
+     * @return the amount of pairs in only one of the structures
+     */
+    size_t distance(const BasePairSet& other) const
+    {
+        return _pairs + other._pairs - 2 * common(other);
+    }
+
+    /** @brief Lower bound of the base pair distance
+     *
+     * Each pair in only one of the structures makes at most two positions
+     * be paired in just one of them, so half of those positions bounds
+     * the distance from below.
+     * @param other: pairs of another structure, of any size
+     * @return a value not greater than distance(other)
+     */
+    size_t lowerBound(const BasePairSet& other) const;
+
+    /** @brief Whether the base pair distance is within a limit
+     *
+     * Only computes the exact distance when the lower bound does not
+     * already exceed the limit.
+     * @param other: pairs of another structure, of any size
+     * @param maxDistance: greatest accepted distance
+     * @return true if distance(other) <= maxDistance
+     */
+    bool within(const BasePairSet& other, const size_t maxDistance) const
+    {
+        return lowerBound(other) <= maxDistance && distance(other) <= maxDistance;
+    }
+
+    /** @brief Pair overlap similarity
+     *
+     * @param other: pairs of another structure, of any size
+     * @return twice the common pairs over the total pairs, in [0, 1];
+     *         1 when neither structure has pairs
+     */
+    double overlap(const BasePairSet& other) const;
+
+    static const size_t POSITIONS_PER_WORD = 64;
+
+private:
+
+    std::vector<uint32_t> _partners;
+    Words _paired;
+    size_t _pairs;
+};
+
+} //namespace fideo
+
+#endif  /* BASE_PAIR_SET_H */
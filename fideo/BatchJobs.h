@@ -0,0 +1,121 @@
+/*
+ * @file     BatchJobs.h
+ * @brief    Provides batch fold and hybridize jobs that run each distinct key once.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing batch services with deduplication.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef BATCH_JOBS_H
+#define BATCH_JOBS_H
+
+#include <vector>
+#include <biopp/biopp.h>
+#include "fideo/RnaBackendsTypes.h"
+#include "fideo/FoldResult.h"
+#include "fideo/IFold.h"
+#include "fideo/IHybridize.h"
+
+namespace fideo
+{
+
+/** @brief A sequence to fold, the key is (sequence, circular, temp)
+ *
+ */
+struct FoldJob
+{
+    FoldJob(const biopp::NucSequence& seq, const bool isCirc, const Temperature t = 37)
+        : sequence(seq), circular(isCirc), temp(t)
+    {}
+
+    biopp::NucSequence sequence;
+    bool circular;
+    Temperature temp;
+};
+
+/** @brief A pair of sequences to hybridize, the key is (target, query, temp)
+ *
+ * The circular flag of the target is part of the key as well.
+ */
+struct HybridizeJob
+{
+    HybridizeJob(const biopp::NucSequence& longer, const bool isCirc, const biopp::NucSequence& shorter, const Temperature t = 37)
+        : longerSeq(longer), longerCirc(isCirc), shorterSeq(shorter), temp(t)
+    {}
+
+    biopp::NucSequence longerSeq;
+    bool longerCirc;
+    biopp::NucSequence shorterSeq;
+    Temperature temp;
+};
+
+/** @brief Summary of the duplicates found in a batch
+ *
+ */
+struct DedupReport
+{
+    DedupReport()
+        : total(0), distinct(0)
+    {}
+
+    /** @brief Fraction of the jobs that were not run, between 0 and 1
+     *
+     */
+    double ratio() const
+    {
+        return total == 0 ? 0.0 : double(total - distinct) / double(total);
+    }
+
+    size_t total;       /// amount of jobs in the batch
+    size_t distinct;    /// amount of jobs actually run
+};
+
+/** @brief Fold a batch running each distinct key once
+ *
+ * @param folder: backend to use
+ * @param jobs: sequences to fold
+ * @param results: to fill with one result per job, in the same order
+ * @param report: to fill with the amount of duplicates
+ * @return void
+ */
+void foldBatch(IFold& folder, const std::vector<FoldJob>& jobs, std::vector<FoldResult>& results, DedupReport& report);
+
+/** @brief Hybridize a batch running each distinct key once
+ *
+ * @param hybridizer: backend to use
+ * @param jobs: pairs to hybridize
+ * @param results: to fill with one free energy per job, in the same order
+ * @param report: to fill with the amount of duplicates
+ * @return void
+ */
+void hybridizeBatch(const IHybridize& hybridizer, const std::vector<HybridizeJob>& jobs, std::vector<Fe>& results, DedupReport& report);
+
+} //namespace fideo
+
+#endif  /* BATCH_JOBS_H */
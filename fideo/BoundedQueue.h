@@ -0,0 +1,98 @@
+/*
+ * @file     BoundedQueue.h
+ * @brief    Provides a blocking queue with a maximum capacity.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing class BoundedQueue.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef BOUNDED_QUEUE_H
+#define BOUNDED_QUEUE_H
+
+#include <deque>
+#include <utility>
+#include <mutex>
+#include <condition_variable>
+
+namespace fideo
+{
+
+/** @brief Queue shared between producer and consumer threads
+ *
+ * Producers block while the queue is full, so the memory used is bounded by
+ * the capacity. Consumers block while the queue is empty and not closed.
+ */
+template <class T>
+class BoundedQueue
+{
+public:
+    /**
+     * Constructor
+     * @param capacity maximum amount of elements held
+     */
+    explicit BoundedQueue(size_t capacity);
+
+    /**
+     * Add an element, waiting while the queue is full.
+     * @param element the element to add, moved into the queue.
+     * @return false if the queue was closed, so the element was not added.
+     */
+    bool push(T element);
+
+    /**
+     * Remove the oldest element, waiting while the queue is empty.
+     * @param element to write the removed element to.
+     * @return false if the queue is closed and empty.
+     */
+    bool pop(T& element);
+
+    /**
+     * Close the queue: wakes up every waiting thread. The remaining elements
+     * can still be popped.
+     */
+    void close();
+
+private:
+    typedef std::unique_lock<std::mutex> Lock;
+
+    const size_t capacity;
+    std::deque<T> elements;
+    bool closed;
+    std::mutex lock;
+    std::condition_variable notFull;
+    std::condition_variable notEmpty;
+};
+
+#define _BOUNDED_QUEUE_INLINE_H
+#include "BoundedQueueInline.h"
+#undef _BOUNDED_QUEUE_INLINE_H
+
+}//namespace fideo
+
+#endif  /* BOUNDED_QUEUE_H */
@@ -0,0 +1,86 @@
+/*
+ * @file     BoundedQueueInline.h
+ * @brief    Provides the implementation of BoundedQueue.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing BoundedQueue inline implementation.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef _BOUNDED_QUEUE_INLINE_H
+#error Internal header file, DO NOT include this.
+#endif
+
+template<class T>
+inline BoundedQueue<T>::BoundedQueue(size_t capacity)
+    : capacity(capacity > 0 ? capacity : 1),
+      elements(),
+      closed(false)
+{}
+
+template<class T>
+inline bool BoundedQueue<T>::push(T element)
+{
+    Lock guard(lock);
+    while (elements.size() >= capacity && !closed)
+        notFull.wait(guard);
+
+    const bool added = !closed;
+    if (added)
+    {
+        elements.push_back(std::move(element));
+        notEmpty.notify_one();
+    }
+    return added;
+}
+
+template<class T>
+inline bool BoundedQueue<T>::pop(T& element)
+{
+    Lock guard(lock);
+    while (elements.empty() && !closed)
+        notEmpty.wait(guard);
+
+    const bool removed = !elements.empty();
+    if (removed)
+    {
+        element = std::move(elements.front());
+        elements.pop_front();
+        notFull.notify_one();
+    }
+    return removed;
+}
+
+template<class T>
+inline void BoundedQueue<T>::close()
+{
+    Lock guard(lock);
+    closed = true;
+    notFull.notify_all();
+    notEmpty.notify_all();
+}
@@ -0,0 +1,126 @@
+/*
+ * @file     ChildProcess.h
+ * @brief    Provides a handle to an external tool running as a child process.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing class ChildProcess.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef CHILD_PROCESS_H
+#define CHILD_PROCESS_H
+
+#include <string>
+#include <mutex>
+#include <sys/types.h>
+#include <etilico/etilico.h>
+#include "fideo/RnaBackendsException.h"
+
+namespace fideo
+{
+
+/** @brief Runs a shell command in its own process group, optionally reading its standard output
+ *
+ * Unlike etilico::runCommand, the caller keeps control of the child: the output
+ * can be consumed as it is produced and the child can be killed at any moment.
+ */
+class ChildProcess
+{
+public:
+
+    /** @brief Constructor of class
+     *
+     */
+    ChildProcess();
+
+    /** @brief Destructor of class. Kills the child if it is still running.
+     *
+     */
+    ~ChildProcess();
+
+    /** @brief Start the command
+     *
+     * @param command: shell command to run
+     * @param captureOutput: if the standard output of the command is read through a pipe
+     * @return void
+     */
+    void start(const etilico::Command& command, const bool captureOutput = true);
+
+    /** @brief Read a block of the standard output
+     *
+     * @param buffer: where to write the bytes read
+     * @param size: size of buffer
+     * @return amount of bytes read, 0 at the end of output
+     */
+    size_t read(char* buffer, const size_t size);
+
+    /** @brief Read a line of the standard output, without the end of line
+     *
+     * @param line: to fill with the line read
+     * @return false at the end of output
+     */
+    bool readLine(std::string& line);
+
+    /** @brief Wait for the child to finish
+     *
+     * @return exit status of the command, or -1 if it was killed by a signal
+     */
+    int wait();
+
+    /** @brief Kill the child and all the processes it started. Can be called from another thread.
+     *
+     * @return void
+     */
+    void kill();
+
+    /** @brief Determine whether the child was started and not waited yet. Only for the owner thread.
+     *
+     */
+    bool running() const
+    {
+        return _pid > 0;
+    }
+
+private:
+
+    ChildProcess(const ChildProcess&);
+    ChildProcess& operator=(const ChildProcess&);
+
+    void closeOutput();
+
+    pid_t _pid;
+    int _output;
+    std::string _pending;
+    size_t _pendingFrom;
+    bool _eof;
+    std::mutex _lock;
+};
+
+} //namespace fideo
+
+#endif  /* CHILD_PROCESS_H */
@@ -27,7 +27,8 @@
 #define _COMBINATOR_H
 
 #include <vector>
-#include <list>
+#include <algorithm>
+#include <stdint.h>
 #include <mili/mili.h>
 #include <biopp/biopp.h>
 #include "fideo/RnaBackendsTypes.h"
@@ -38,6 +39,12 @@ namespace fideo
 
 /**
  * Iterator over the combinations for a given container.
+ *
+ * The elements are copied once to contiguous storage and combinations
+ * are enumerated in lexicographic order of their element positions.
+ * Each combination has a rank in [0, size()), so the enumeration can
+ * start anywhere (unrank) and be restricted to a range of ranks; disjoint
+ * ranges can then be explored by different workers without coordination.
  */
 template <class C>
 class Combinator
@@ -45,21 +52,60 @@ class Combinator
 public:
     typedef typename C::value_type CType;
     typedef std::vector<CType> Combination;
+    typedef uint64_t Rank;
     /**
-     * Sets the iterator at the begining.
+     * Sets the iterator at the begining of its range.
      */
     void begin();
     /**
-     * Gets the next combination
+     * Gets the next combination, without allocating once comb has the
+     * right size. When the range is exhausted it wraps around to its
+     * first combination.
      * @param comb Combination to write to.
-     * @return If there are more combinations.
+     * @return false if it wrapped around, i.e. comb is the first combination again.
      */
     bool next(Combination& comb);
     /**
-     * Update the size of combinations and restart the iterator
+     * Update the size of combinations and restart the iterator over
+     * the whole space.
      * @param n the new size
      */
     void update(size_t n);
+    /**
+     * Amount of combinations; throws CombinatorException if it does not fit in a Rank.
+     */
+    Rank size() const;
+    /**
+     * Gets the combination of a given rank.
+     * @param rank position of the combination, lower than size().
+     * @param comb Combination to write to.
+     */
+    void unrank(Rank rank, Combination& comb) const;
+    /**
+     * Rank of the combination that the next call to next() will return.
+     */
+    Rank position() const
+    {
+        return current;
+    }
+    /**
+     * Move the iterator, so the next call to next() returns the combination of a given rank.
+     * @param rank position inside the current range.
+     */
+    void seek(Rank rank);
+    /**
+     * Restrict the enumeration to the ranks [from, to) and restart the iterator.
+     * @param from the first rank.
+     * @param to one past the last rank, at most size().
+     */
+    void set_range(Rank from, Rank to);
+    /**
+     * Restrict the enumeration to one of several disjoint and contiguous ranges
+     * of about the same length that cover the whole space.
+     * @param parts amount of ranges.
+     * @param part index of the range, lower than parts.
+     */
+    void partition(size_t parts, size_t part);
     /**
      * Constructor
      * @param e the container of elements to generate combinations
@@ -74,24 +120,24 @@ public:
     Combinator(size_t range, size_t n);
 
 private:
-    typedef typename C::const_iterator ConstIterator;
-    C elements;
-    Combination combination;
+    std::vector<CType> elements;
+    std::vector<size_t> indexes;    //positions in 'elements' of the next combination.
+    std::vector<Rank> binomials;    //binomials(m, j) for m <= elements.size(), j <= k; 0 means it overflows.
 
     size_t k;
+    Rank current;
+    Rank first;
+    Rank last;
+    bool wrapped;   //the next combination is the first again after a full cycle.
 
-    ConstIterator end;
-    ConstIterator start;
-    ConstIterator kit;
-
-    /**
-     * Sets the elements being combined.
-     */
-    void move();
+    Rank binomial(size_t m, size_t j) const;
+    void build_binomials();
+    void unrank_indexes(Rank rank, std::vector<size_t>& idx) const;
+    bool advance();
 };
 
-typedef Combinator<std::list<biopp::SeqIndex> > SeqIndexesCombinator;
-typedef Combinator<std::list<biopp::SeqIndex> >::Combination SeqIndexesCombination;
+typedef Combinator<std::vector<biopp::SeqIndex> > SeqIndexesCombinator;
+typedef Combinator<std::vector<biopp::SeqIndex> >::Combination SeqIndexesCombination;
 
 #define _COMBINATOR_INLINE_H
 #include "CombinatorInline.h"
@@ -35,101 +35,227 @@
 #error Internal header file, DO NOT include this.
 #endif
 
+static const uint64_t COMBINATOR_OVERFLOW = ~uint64_t(0);
+
 template<class C>
 inline Combinator<C>::Combinator(const C& e, size_t n)
-    : elements(e),
-      combination(n),
+    : elements(e.begin(), e.end()),
+      indexes(n),
+      binomials(),
       k(n),
-      end(),
-      start(),
-      kit()
+      current(0),
+      first(0),
+      last(0),
+      wrapped(false)
 {
-    if (e.size() < n)
+    if (elements.size() < n)
         throw CombinatorException();
 
-    begin();
+    build_binomials();
+    update(n);
 }
 
 template<class C>
 inline Combinator<C>::Combinator(size_t range, size_t n)
     : elements(range),
-      combination(n),
+      indexes(n),
+      binomials(),
       k(n),
-      end(),
-      start(),
-      kit()
+      current(0),
+      first(0),
+      last(0),
+      wrapped(false)
 {
     if (range < n)
         throw CombinatorException();
 
-    C range_ct;
     for (size_t i = 0; i < range; ++i)
     {
-        insert_into(range_ct, i);
+        elements[i] = i;
+    }
+    build_binomials();
+    update(n);
+}
+
+template<class C>
+inline void Combinator<C>::build_binomials()
+{
+    //Pascal's triangle, saturating on overflow.
+    const size_t n = elements.size();
+    binomials.assign((n + 1) * (k + 1), 0);
+    for (size_t m = 0; m <= n; ++m)
+    {
+        binomials[m * (k + 1)] = 1;
+        for (size_t j = 1; j <= k && j <= m; ++j)
+        {
+            const Rank a = binomials[(m - 1) * (k + 1) + j - 1];
+            const Rank b = binomials[(m - 1) * (k + 1) + j];
+            binomials[m * (k + 1) + j] = (a == COMBINATOR_OVERFLOW || b == COMBINATOR_OVERFLOW || a + b < a) ? COMBINATOR_OVERFLOW : a + b;
+        }
     }
-    elements = range_ct;
-    begin();
+}
+
+template<class C>
+inline typename Combinator<C>::Rank Combinator<C>::binomial(size_t m, size_t j) const
+{
+    return j > m ? 0 : binomials[m * (k + 1) + j];
 }
 
 template<class C>
 inline void Combinator<C>::update(size_t n)
 {
-    k = n;
-    combination.clear();
-    combination.resize(n);
+    if (elements.size() < n)
+        throw CombinatorException();
+
+    if (n != k)
+    {
+        k = n;
+        build_binomials();
+    }
+    indexes.resize(n);
+    first = 0;
+    //an overflowing size is only a problem for rank based operations.
+    last = binomial(elements.size(), k);
     begin();
 }
 
 template<class C>
-inline void Combinator<C>::begin()
+inline typename Combinator<C>::Rank Combinator<C>::size() const
 {
-    start = elements.begin();
-    end = elements.end();
-    move();
+    const Rank total = binomial(elements.size(), k);
+    if (total == COMBINATOR_OVERFLOW)
+        throw CombinatorException();
+    return total;
 }
 
 template<class C>
-inline void Combinator<C>::move()
+inline void Combinator<C>::unrank_indexes(Rank rank, std::vector<size_t>& idx) const
 {
-    if (k == 0)
-        kit = end;
-    else
+    const size_t n = elements.size();
+    size_t x = 0;
+    for (size_t i = 0; i < k; ++i)
     {
-        ConstIterator it = start;
-        for (size_t i = 0; i < k; ++i)
+        //skip the blocks of combinations whose i-th index is lower than x.
+        Rank block = binomial(n - 1 - x, k - 1 - i);
+        while (rank >= block)
         {
-            combination[i] = *it;
-            if (i == k - 1)
-                kit = it;
-            ++it;
+            rank -= block;
+            ++x;
+            block = binomial(n - 1 - x, k - 1 - i);
         }
+        idx[i] = x;
+        ++x;
     }
 }
 
 template<class C>
-inline bool Combinator<C>::next(Combination& comb)
+inline void Combinator<C>::unrank(Rank rank, Combination& comb) const
+{
+    if (rank >= size())
+        throw CombinatorException();
+
+    std::vector<size_t> idx(k);
+    unrank_indexes(rank, idx);
+    comb.resize(k);
+    for (size_t i = 0; i < k; ++i)
+    {
+        comb[i] = elements[idx[i]];
+    }
+}
+
+template<class C>
+inline void Combinator<C>::seek(Rank rank)
+{
+    if (rank < first || rank >= last)
+        throw CombinatorException();
+
+    unrank_indexes(rank, indexes);
+    current = rank;
+    wrapped = false;
+}
+
+template<class C>
+inline void Combinator<C>::set_range(Rank from, Rank to)
+{
+    if (from >= to || to > size())
+        throw CombinatorException();
+
+    first = from;
+    last = to;
+    begin();
+}
+
+template<class C>
+inline void Combinator<C>::partition(size_t parts, size_t part)
 {
-    bool more(true);
+    if (part >= parts)
+        throw CombinatorException();
+
+    const Rank total = size();
+    const Rank from = total / parts * part + std::min<Rank>(part, total % parts);
+    const Rank to = from + total / parts + (part < total % parts ? 1 : 0);
+    set_range(from, to);
+}
 
-    if (kit != end)
+template<class C>
+inline void Combinator<C>::begin()
+{
+    if (first == 0)
     {
-        comb = combination;
-        ++kit;
-        if (kit == end && k > 1)
+        for (size_t i = 0; i < k; ++i)
         {
-            ++start;
-            move();
+            indexes[i] = i;
         }
-        else
-            combination[k - 1] = *kit;
     }
     else
     {
-        more = false;
+        unrank_indexes(first, indexes);
+    }
+    current = first;
+    wrapped = false;
+}
+
+template<class C>
+inline bool Combinator<C>::advance()
+{
+    //lexicographic successor: increment the rightmost index that can grow
+    //and reset the following ones right after it.
+    const size_t n = elements.size();
+    size_t i = k;
+    while (i > 0 && indexes[i - 1] == n - k + i - 1)
+    {
+        --i;
+    }
+    if (i == 0)
+        return false;
+
+    ++indexes[i - 1];
+    for (size_t j = i; j < k; ++j)
+    {
+        indexes[j] = indexes[j - 1] + 1;
+    }
+    return true;
+}
+
+template<class C>
+inline bool Combinator<C>::next(Combination& comb)
+{
+    const bool more = !wrapped;
+    comb.resize(k);
+    for (size_t i = 0; i < k; ++i)
+    {
+        comb[i] = elements[indexes[i]];
+    }
+
+    ++current;
+    if (current == last || !advance())
+    {
         //Make it cyclic
         begin();
-        comb = combination;
+        wrapped = true;
     }
+    else
+        wrapped = false;
 
     return more;
 }
@@ -0,0 +1,144 @@
+/*
+ * @file     DesignScheduler.h
+ * @brief    Scheduler of inverse folding jobs.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing class DesignScheduler.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef DESIGN_SCHEDULER_H
+#define DESIGN_SCHEDULER_H
+
+#include <string>
+#include <vector>
+#include <biopp/biopp.h>
+#include "fideo/RnaBackendsTypes.h"
+#include "fideo/IFoldInverse.h"
+
+namespace fideo
+{
+
+/** @brief Designs wanted for a target structure
+ *
+ * Each job carries its own InverseFoldParams, which refer to the
+ * structure kept by the job. The search is bounded by the budget.
+ */
+struct DesignJob
+{
+    DesignJob(const InverseFoldParams& jobParams, const biopp::NucSequence& startSeq, const size_t designs,
+              const DesignBudget& jobBudget = DesignBudget(), const Temperature t = 37)
+        : structure(jobParams.structure), params(structure, jobParams), start(startSeq), count(designs),
+          budget(jobBudget), temp(t)
+    {}
+
+    DesignJob(const DesignJob& other)
+        : structure(other.structure), params(structure, other.params), start(other.start), count(other.count),
+          budget(other.budget), temp(other.temp)
+    {}
+
+    biopp::SecStructure structure;
+    InverseFoldParams params;   /// parameters of the backend, for structure
+    biopp::NucSequence start;
+    size_t count;               /// amount of designs wanted
+    DesignBudget budget;        /// limits of the whole job
+    Temperature temp;
+
+private:
+    DesignJob& operator=(const DesignJob&);
+};
+
+/** @brief How a job ended
+ *
+ */
+enum DesignJobStatus
+{
+    JobCompleted,               /// all the designs were found
+    JobBudgetExhausted,         /// the budget ran out first
+    JobFailed                   /// the backend failed
+};
+
+/** @brief Receives the results of the jobs as they are found
+ *
+ * Calls are serialized by the scheduler, so implementations
+ * need no locking; they should return quickly and not throw.
+ */
+struct IDesignSink
+{
+    /** @brief A new design for a job
+     *
+     * @param job: index of the job in the batch
+     * @param design: the sequence found
+     */
+    virtual void designed(const size_t job, const biopp::NucSequence& design) = 0;
+
+    /** @brief A job ended, no more designs will come for it
+     *
+     * @param job: index of the job in the batch
+     * @param status: how the job ended
+     * @param designs: amount of designs found
+     */
+    virtual void finished(const size_t job, const DesignJobStatus status, const size_t designs) = 0;
+
+    virtual ~IDesignSink() {}
+};
+
+/** @brief Runs batches of design jobs on a pool of workers
+ *
+ * Each worker owns a queue of jobs and, when it runs out of them,
+ * steals from the others, so that a few hard structures do not keep
+ * easy ones waiting behind them.
+ */
+class DesignScheduler
+{
+public:
+    /** @brief Constructor of class
+     *
+     * @param backend: name of the IFoldInverse backend to use
+     * @param workers: amount of jobs run concurrently
+     */
+    DesignScheduler(const std::string& backend, const size_t workers);
+
+    /** @brief Run all the jobs, returning when all have finished
+     *
+     * @param jobs: the batch
+     * @param sink: to receive the designs and the end of each job
+     * @return void
+     */
+    void run(const std::vector<DesignJob>& jobs, IDesignSink& sink) const;
+
+private:
+    class Batch;
+
+    const std::string backend;
+    const size_t workers;
+};
+
+} //namespace fideo
+
+#endif  /* DESIGN_SCHEDULER_H */
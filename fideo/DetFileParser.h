@@ -71,6 +71,7 @@ public:
 
     /** @brief Parse a '.det' file
      *
+     * The motifs are delivered with one call to processMotifs.
      * @param file: file name to parse
      * @param observer: specific implementacion
      * @return void
@@ -140,13 +141,13 @@ private:
      */
     void parseStackLine(const std::string& line, std::string& nameToFill) const;
 
-    /** @brief Parse the current block and fill the motif
+    /** @brief Parse the current block and fill its record
      *
      * @param block: block to parse
-     * @param motif: specific implementation of IMotifObserver
+     * @param record: to fill with the motif of the block
      * @return void
      */
-    void parseBlock(const Block& block, IMotifObserver::Motif& motif);
+    void parseBlock(const Block& block, MotifRecord& record);
 
     /** @brief Load the available rules
      *
@@ -0,0 +1,114 @@
+/*
+ * @file     DiversityFilter.h
+ * @brief    Rejection of near-duplicate designs.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing class DiversityFilter.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef DIVERSITY_FILTER_H
+#define DIVERSITY_FILTER_H
+
+#include <vector>
+#include <stdint.h>
+#include "fideo/RnaBackendsTypes.h"
+#include "fideo/PackedSequence.h"
+
+namespace fideo
+{
+
+/** @brief Keeps designs of one length at a minimum Hamming distance
+ *
+ * The packed designs are stored back to back in a single array, so
+ * checking a candidate is one inlined scan of XORs and popcounts over
+ * it, with the popcount instruction when the processor has it. The
+ * cost is linear: a word read and a popcount per 32 bases of each
+ * design, e.g. 400000 words for 100000 designs of 100 bases, which is
+ * most of a millisecond. Keep the amount of designs bounded.
+ */
+class DiversityFilter
+{
+public:
+
+    /** @brief Constructor of class
+     *
+     * @param distance: candidates within this distance of a design are
+     *                  rejected; 0 disables the filter
+     */
+    explicit DiversityFilter(const Distance distance = 0);
+
+    /** @brief Whether a candidate is far enough from all the designs
+     *
+     * @param candidate: the packed candidate
+     * @return true if no design is within the distance
+     */
+    bool admits(const PackedSequence& candidate) const;
+
+    /** @brief Add a design
+     *
+     * All the designs must have the same size.
+     * @param design: the packed design
+     * @return void
+     */
+    void insert(const PackedSequence& design);
+
+    /** @brief Remove all the designs
+     *
+     * @return void
+     */
+    void clear();
+
+    /** @brief Whether the filter rejects anything
+     *
+     */
+    bool enabled() const
+    {
+        return _distance > 0;
+    }
+
+    /** @brief Amount of designs
+     *
+     */
+    size_t size() const
+    {
+        return _designs;
+    }
+
+private:
+
+    const Distance _distance;
+    size_t _bases;
+    size_t _stride;
+    size_t _designs;
+    std::vector<uint64_t> _words;
+};
+
+} //namespace fideo
+
+#endif  /* DIVERSITY_FILTER_H */
@@ -0,0 +1,120 @@
+/*
+ * @file     FastaPipeline.h
+ * @brief    Provides fold and hybridize pipelines fed by a streaming FASTA reader.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing foldFasta and hybridizeFasta.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef FASTA_PIPELINE_H
+#define FASTA_PIPELINE_H
+
+#include <string>
+#include <biopp/biopp.h>
+#include "fideo/RnaBackendsTypes.h"
+#include "fideo/FastaReader.h"
+
+namespace fideo
+{
+
+/** @brief Parameters of a FASTA pipeline
+ *
+ * The memory used is bounded by queueCapacity * batchSize sequences, plus the
+ * ones being processed by the workers.
+ */
+struct FastaPipelineParams
+{
+    FastaPipelineParams();
+
+    size_t workers;         /// amount of worker threads, each one with its own backend
+    size_t batchSize;       /// amount of sequences handed to a worker at once
+    size_t queueCapacity;   /// maximum amount of batches waiting for a worker
+    bool circular;          /// if the sequences are circular
+    Temperature temp;       /// temperature to fold or hybridize
+};
+
+/** @brief Receives the results of a fold pipeline. Calls are serialized.
+ *
+ */
+struct IFoldResultObserver
+{
+    /** @brief Process the result of a sequence
+     *
+     * @param record: the sequence folded
+     * @param freeEnergy: the free energy of the structure
+     * @param structure: the structure folded
+     * @return void
+     */
+    virtual void processFold(const FastaRecord& record, const Fe freeEnergy, const biopp::SecStructure& structure) = 0;
+
+    virtual ~IFoldResultObserver() {}
+};
+
+/** @brief Receives the results of a hybridize pipeline. Calls are serialized.
+ *
+ */
+struct IHybridizeResultObserver
+{
+    /** @brief Process the result of a sequence
+     *
+     * @param record: the longer sequence hybridized
+     * @param freeEnergy: the free energy of the hybridization
+     * @return void
+     */
+    virtual void processHybridize(const FastaRecord& record, const Fe freeEnergy) = 0;
+
+    virtual ~IHybridizeResultObserver() {}
+};
+
+/** @brief Fold every sequence of a FASTA file
+ *
+ * The file is read while the workers fold the batches already read. Results
+ * are reported in completion order, not in file order.
+ * @param file: FASTA file, plain or gzip compressed
+ * @param backend: name of the folding backend
+ * @param params: pipeline parameters
+ * @param observer: receives the results
+ * @return void
+ */
+void foldFasta(const FilePath& file, const std::string& backend, const FastaPipelineParams& params, IFoldResultObserver& observer);
+
+/** @brief Hybridize every sequence of a FASTA file with a given shorter sequence
+ *
+ * @param file: FASTA file of longer sequences, plain or gzip compressed
+ * @param backend: name of the hybridize backend
+ * @param shorterSeq: shorter sequence to hybridize with each sequence of the file
+ * @param params: pipeline parameters
+ * @param observer: receives the results
+ * @return void
+ */
+void hybridizeFasta(const FilePath& file, const std::string& backend, const biopp::NucSequence& shorterSeq, const FastaPipelineParams& params, IHybridizeResultObserver& observer);
+
+} //namespace fideo
+
+#endif  /* FASTA_PIPELINE_H */
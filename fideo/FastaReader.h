@@ -0,0 +1,111 @@
+/*
+ * @file     FastaReader.h
+ * @brief    Provides a streaming reader of FASTA files.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing class FastaReader.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef FASTA_READER_H
+#define FASTA_READER_H
+
+#include <string>
+#include "fideo/FideoHelper.h"
+#include "fideo/ChildProcess.h"
+
+namespace fideo
+{
+
+/** @brief Represents a sequence read from a FASTA file
+ *
+ */
+struct FastaRecord
+{
+    size_t index;           /// position of the record in the file, starting at 0
+    std::string name;       /// header line without the leading '>'
+    std::string sequence;
+};
+
+/** @brief Reads the records of a FASTA file one at a time
+ *
+ * Plain files are memory-mapped; gzip compressed files are decompressed
+ * through a pipe from 'gzip -dc', so the whole file is never held in memory.
+ */
+class FastaReader
+{
+public:
+
+    /** @brief Constructor of class
+     *
+     * @param file: FASTA file, plain or gzip compressed
+     */
+    FastaReader(const FilePath& file);
+
+    /** @brief Destructor of class
+     *
+     */
+    ~FastaReader();
+
+    /** @brief Read the next record
+     *
+     * @param record: to fill with the record read
+     * @return false if there are no more records
+     */
+    bool next(FastaRecord& record);
+
+private:
+
+    FastaReader(const FastaReader&);
+    FastaReader& operator=(const FastaReader&);
+
+    /** @brief Get the next line of the file, without the end of line
+     *
+     * @param line: to point to the first char of the line
+     * @param length: to fill with the length of the line
+     * @return false at the end of file
+     */
+    bool nextLine(const char*& line, size_t& length);
+
+    static bool isCompressed(const FilePath& file);
+
+    const FilePath _file;
+    const bool _compressed;
+    ChildProcess _gunzip;
+    std::string _line;
+    const char* _mapped;
+    size_t _mappedSize;
+    size_t _cursor;
+    std::string _header;
+    bool _headerPending;
+    size_t _records;
+};
+
+} //namespace fideo
+
+#endif  /* FASTA_READER_H */
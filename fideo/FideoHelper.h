@@ -40,8 +40,19 @@
 #include <fstream>
 #include <cerrno>
 #include <unistd.h>
+#include <stdint.h>
 #include "fideo/RnaBackendsException.h"
 
+/** @brief Compile a function for processors with the popcount instruction
+ *
+ * Only x86 needs it; elsewhere __builtin_popcountll is already native.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FIDEO_TARGET_POPCNT __attribute__((target("popcnt")))
+#else
+#define FIDEO_TARGET_POPCNT
+#endif
+
 namespace fideo
 {
 
@@ -90,6 +101,46 @@ void write(const FilePath& file, FileLine& line);
 */
 void readLine(const FilePath& file, FileLineNo lineno, FileLine& line);
 
+/** @brief Read a whole file with a single read
+ *
+ * @param file: file path
+ * @param content: where to write the content of the file
+ * @return void
+ */
+void readFile(const FilePath& file, std::string& content);
+
+/** @brief Initial value of hash64
+ *
+ */
+static const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+
+/** @brief Compute the CRC-32 checksum of a block of bytes
+ *
+ * @param data: bytes to checksum
+ * @param length: amount of bytes
+ * @param crc: checksum of the previous blocks, to chain calls
+ * @return the checksum
+ */
+uint32_t crc32(const void* data, const size_t length, const uint32_t crc = 0);
+
+/** @brief Compute the 64 bits FNV-1a hash of a block of bytes
+ *
+ * @param data: bytes to hash
+ * @param length: amount of bytes
+ * @param hash: hash of the previous blocks, to chain calls
+ * @return the hash
+ */
+uint64_t hash64(const void* data, const size_t length, const uint64_t hash = FNV_OFFSET_BASIS);
+
+/** @brief Whether the processor has a popcount instruction
+ *
+ * Checked once, at the first call. Code counting bits in loops compiles
+ * a variant with FIDEO_TARGET_POPCNT and picks it at run time with this,
+ * so the build needs no -mpopcnt and runs anywhere.
+ * @return true if it is available
+ */
+bool hasPopcount();
+
 #define FIDEO_HELPER_INLINE_H
 #include "FideoHelperInline.h"
 #undef FIDEO_HELPER_INLINE_H
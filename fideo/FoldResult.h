@@ -0,0 +1,126 @@
+/*
+ * @file     FoldResult.h
+ * @brief    Provides a fold result that decodes its structure on demand.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing class FoldResult.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef FOLD_RESULT_H
+#define FOLD_RESULT_H
+
+#include <biopp/biopp.h>
+#include "fideo/RnaBackendsTypes.h"
+#include "fideo/PackedStructure.h"
+
+namespace fideo
+{
+
+/** @brief Result of a fold that keeps the structure packed until it is required
+ *
+ * The free energy is available immediately; the SecStructure is decoded from
+ * the packed backend output only on the first call to structure().
+ * Not thread safe: share between threads only after the first decode.
+ */
+class FoldResult
+{
+public:
+
+    /** @brief Constructor of class
+     *
+     */
+    FoldResult();
+
+    /** @brief Load a new result, discarding any decoded structure
+     *
+     * @param freeEnergy: free energy of the structure
+     * @param isCirc: if the structure it's circular
+     * @param packed: packed structure, swapped into the result
+     * @return void
+     */
+    void assign(const Fe freeEnergy, const bool isCirc, PackedStructure& packed);
+
+    /** @brief Free energy of the structure
+     *
+     */
+    Fe energy() const
+    {
+        return _energy;
+    }
+
+    /** @brief If the structure it's circular
+     *
+     */
+    bool circular() const
+    {
+        return _circular;
+    }
+
+    /** @brief Amount of positions in the structure
+     *
+     */
+    size_t size() const
+    {
+        return _packed.size();
+    }
+
+    /** @brief If the structure was already decoded
+     *
+     */
+    bool decoded() const
+    {
+        return _decoded;
+    }
+
+    /** @brief Structure in its packed form, never decoded
+     *
+     */
+    const PackedStructure& packed() const
+    {
+        return _packed;
+    }
+
+    /** @brief Structure decoded on first access
+     *
+     * @return the secondary structure
+     */
+    const biopp::SecStructure& structure() const;
+
+private:
+
+    Fe _energy;
+    bool _circular;
+    PackedStructure _packed;
+    mutable bool _decoded;
+    mutable biopp::SecStructure _structure;
+};
+
+} //namespace fideo
+
+#endif  /* FOLD_RESULT_H */
@@ -0,0 +1,268 @@
+/*
+ * @file     FoldResultStore.h
+ * @brief    Provides an append-only binary store for folding and hybridization results.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing FoldResultWriter and FoldResultReader.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef FOLD_RESULT_STORE_H
+#define FOLD_RESULT_STORE_H
+
+#include <string>
+#include <fstream>
+#include <stdint.h>
+#include <biopp/biopp.h>
+#include "fideo/RnaBackendsTypes.h"
+#include "fideo/FideoHelper.h"
+#include "fideo/PackedStructure.h"
+#include "fideo/IFold.h"
+#include "fideo/IHybridize.h"
+
+namespace fideo
+{
+
+/** @brief A single result kept in the store
+ *
+ * Hybridization results are stored with an empty structure.
+ */
+struct FoldRecord
+{
+    std::string sequenceId;
+    std::string backend;
+    Temperature temperature;
+    Fe energy;
+    bool circular;
+    PackedStructure structure;
+};
+
+/** @brief Layout of the store files
+ *
+ * The store is made of two files written in native byte order:
+ *  - the data file, a header followed by the records appended one after the other.
+ *  - the index file (data file name + ".idx"), a header followed by one fixed size
+ *    entry per record with its offset, length and CRC-32. Each entry carries its
+ *    own checksum, so a torn tail after a crash is detected and ignored.
+ */
+struct FoldResultStoreFormat
+{
+    struct FileHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t reserved;
+    };
+
+    struct RecordHeader
+    {
+        uint32_t idLength;
+        uint32_t backendLength;
+        uint32_t structureSize;
+        uint32_t flags;
+        double temperature;
+        double energy;
+    };
+
+    struct IndexEntry
+    {
+        uint64_t offset;
+        uint32_t length;
+        uint32_t recordChecksum;
+        uint32_t entryChecksum;
+        uint32_t reserved;
+    };
+
+    static const uint32_t VERSION = 1;
+    static const uint32_t FLAG_CIRCULAR = 0x1;
+    static const size_t RECORD_ALIGNMENT = 8;
+    static const char DATA_MAGIC[8];
+    static const char INDEX_MAGIC[8];
+    static const std::string INDEX_SUFFIX;
+};
+
+/** @brief Appends results to a store, creating it if it does not exist
+ *
+ * Opening an existing store first cuts the torn tails a crash may have
+ * left: the index is truncated to its last whole entry whose record is
+ * complete, and the data file to the end of that record.
+ */
+class FoldResultWriter
+{
+public:
+
+    /** @brief Constructor of class
+     *
+     * @param file: path of the data file
+     */
+    FoldResultWriter(const FilePath& file);
+
+    /** @brief Destructor of class. Flush the data file before the index file.
+     *
+     */
+    ~FoldResultWriter();
+
+    /** @brief Append a record
+     *
+     * @param record: record to append
+     * @return void
+     */
+    void append(const FoldRecord& record);
+
+    /** @brief Flush the pending records to disk
+     *
+     * @return void
+     */
+    void flush();
+
+private:
+
+    FoldResultWriter(const FoldResultWriter&);
+    FoldResultWriter& operator=(const FoldResultWriter&);
+
+    /** @brief Truncate the files of the store to their last valid record
+     *
+     * @param file: path of the data file
+     * @return void
+     */
+    static void recover(const FilePath& file);
+
+    /** @brief Open a file of the store, writing its header if it is new
+     *
+     * @param path: file to open
+     * @param magic: expected magic of the file
+     * @param out: stream to open
+     * @return size of the file
+     */
+    static uint64_t open(const FilePath& path, const char* magic, std::ofstream& out);
+
+    std::ofstream _data;
+    std::ofstream _index;
+    uint64_t _offset;
+    std::string _buffer;
+};
+
+/** @brief Gives random access to the records of a store using a memory mapping
+ *
+ */
+class FoldResultReader
+{
+public:
+
+    /** @brief Constructor of class
+     *
+     * @param file: path of the data file
+     */
+    FoldResultReader(const FilePath& file);
+
+    /** @brief Destructor of class
+     *
+     */
+    ~FoldResultReader();
+
+    /** @brief Amount of valid records in the store
+     *
+     */
+    size_t size() const
+    {
+        return _records;
+    }
+
+    /** @brief Read a record
+     *
+     * @param index: number of record, starting at 0
+     * @param record: to fill with the record
+     * @return void
+     */
+    void read(const size_t index, FoldRecord& record) const;
+
+    /** @brief Read only the free energy of a record, skipping the checksum verification
+     *
+     * @param index: number of record, starting at 0
+     * @return free energy
+     */
+    Fe energy(const size_t index) const;
+
+private:
+
+    FoldResultReader(const FoldResultReader&);
+    FoldResultReader& operator=(const FoldResultReader&);
+
+    /** @brief Represents a mapped file
+     *
+     */
+    struct MappedFile
+    {
+        const char* data;
+        size_t size;
+    };
+
+    static void map(const FilePath& path, const char* magic, MappedFile& mapped);
+    static void unmap(MappedFile& mapped);
+
+    /** @brief Get the record bytes, checking its checksum
+     *
+     */
+    const char* record(const size_t index, FoldResultStoreFormat::RecordHeader& header) const;
+
+    MappedFile _data;
+    MappedFile _index;
+    const char* _entries;
+    size_t _records;
+};
+
+/** @brief Fold a sequence and append the result to a store
+ *
+ * @param folder: folding backend
+ * @param backend: name of the folding backend
+ * @param sequenceId: identifier of the sequence
+ * @param sequence: the RNA sequence to fold
+ * @param isCirc: if the sequence it's circular
+ * @param store: where to append the result
+ * @param temp: temperature to fold. By default is 37 grades.
+ * @return The free energy in the structure.
+ */
+Fe foldToStore(IFold& folder, const std::string& backend, const std::string& sequenceId, const biopp::NucSequence& sequence, const bool isCirc, FoldResultWriter& store, const Temperature temp = 37);
+
+/** @brief Hybridize two sequences and append the result to a store
+ *
+ * @param hybridizer: hybridize backend
+ * @param backend: name of the hybridize backend
+ * @param pairId: identifier of the pair of sequences
+ * @param longerSeq: longer sequence to hybridize
+ * @param longerCirc: if the longerSeq it's circular
+ * @param shorterSeq: shorter sequence to hybridize
+ * @param store: where to append the result
+ * @param temp: temperature to hybridize. By default is 37 grades.
+ * @return The free energy.
+ */
+Fe hybridizeToStore(const IHybridize& hybridizer, const std::string& backend, const std::string& pairId, const biopp::NucSequence& longerSeq, const bool longerCirc, const biopp::NucSequence& shorterSeq, FoldResultWriter& store, const Temperature temp = 37);
+
+} //namespace fideo
+
+#endif  /* FOLD_RESULT_STORE_H */
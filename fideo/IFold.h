@@ -45,6 +45,7 @@
 #include "fideo/RnaBackendsTypes.h"
 #include "fideo/FideoHelper.h"
 #include "fideo/IMotifObserver.h"
+#include "fideo/FoldResult.h"
 
 namespace fideo
 {
@@ -124,6 +125,28 @@ struct IFold
      */
     virtual Fe foldFrom(const FilePath& inputFile, biopp::SecStructure& structureRNAm, IMotifObserver* motifObserver) = 0;
 
+    /** @brief Compute only the minimum free energy of an RNA sequence
+     *
+     * The backend takes its cheapest path to the MFE (skipping the traceback
+     * where the tool supports it) and no structure is parsed.
+     * @param seqRNAm: the RNA sequence to fold.
+     * @param isCircRNAm: if the structure it's circular.
+     * @param temp: temperature to fold. By default is 37 grades.
+     * @return The minimum free energy.
+     */
+    virtual Fe foldEnergy(const biopp::NucSequence& seqRNAm, const bool isCircRNAm, const Temperature temp = 37) = 0;
+
+    /** @brief Fold an RNA sequence keeping the structure packed
+     *
+     * The structure is decoded only when result.structure() is first called.
+     * @param seqRNAm: the RNA sequence to fold.
+     * @param isCircRNAm: if the structure it's circular.
+     * @param result: to fill with the free energy and the packed structure.
+     * @param temp: temperature to fold. By default is 37 grades.
+     * @return void
+     */
+    virtual void foldLazy(const biopp::NucSequence& seqRNAm, const bool isCircRNAm, FoldResult& result, const Temperature temp = 37) = 0;
+
     /** @brief Class destructor
      *
      */
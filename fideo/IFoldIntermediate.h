@@ -119,6 +119,25 @@ public:
      */
     virtual Fe foldFrom(const FilePath& inputFile, biopp::SecStructure& structureRNAm, IMotifObserver* motifObserver) = 0;
 
+    /** @brief Compute only the minimum free energy and deletes all file generated
+     *
+     * @param seqRNAm: the RNA sequence to fold.
+     * @param isCircRNAm: if the structure it's circular.
+     * @param temp: temperature to fold. By default is 37 grades.
+     * @return The minimum free energy.
+     */
+    virtual Fe foldEnergy(const biopp::NucSequence& seqRNAm, const bool isCircRNAm, const Temperature temp = 37);
+
+    /** @brief Fold an RNA sequence keeping the structure packed and deletes all file generated
+     *
+     * @param seqRNAm: the RNA sequence to fold.
+     * @param isCircRNAm: if the structure it's circular.
+     * @param result: to fill with the free energy and the packed structure.
+     * @param temp: temperature to fold. By default is 37 grades.
+     * @return void
+     */
+    virtual void foldLazy(const biopp::NucSequence& seqRNAm, const bool isCircRNAm, FoldResult& result, const Temperature temp = 37);
+
     /** @brief Destructor of class
      *
      */
@@ -184,6 +203,43 @@ private:
      */
     virtual void renameNecessaryFiles(const std::string& nameFile, const std::string& newNameFile) = 0;
 
+    /** @brief Prepare the cheapest command that yields only the free energy
+     *
+     * @param sequence: the RNA sequence to fold.
+     * @param isCirc: if the sequence's circular.
+     * @param command: to fill with execute Command
+     * @param inputFile: to fill with the input file, if any
+     * @param outputFile: output file generated by folder
+     * @param temp: temperature to fold. By default is 37 grades.
+     * @return void
+     */
+    virtual void prepareEnergyData(const biopp::NucSequence& sequence, const bool isCirc, etilico::Command& command, InputFile& inputFile, OutputFile& outputFile, const Temperature temp = 37) = 0;
+
+    /** @brief Read the free energy without parsing the structure
+     *
+     * @param outputFile: file to process
+     * @param freeEnergy: to fill with free energy
+     * @return void
+     */
+    virtual void processingEnergy(const OutputFile& outputFile, Fe& freeEnergy) = 0;
+
+    /** @brief Delete all files generated by an energy-only fold
+     *
+     * @param inFile: input file
+     * @param outFile: output file
+     * @return void
+     */
+    virtual void deleteFilesAfterEnergy(const InputFile& inFile, const OutputFile& outFile) = 0;
+
+    /** @brief Processing folding results into a packed structure
+     *
+     * @param inputFile: file to process
+     * @param structure: to fill with the packed structure
+     * @param freeEnergy: to fill with free energy
+     * @return void
+     */
+    virtual void processingRawResult(const InputFile& inputFile, PackedStructure& structure, Fe& freeEnergy) = 0;
+
 protected:
 
     /** @brief Get the name of sequence. This is a substring in the description sequence
@@ -26,6 +26,7 @@
 #ifndef _IFOLDINVERSE_H
 #define _IFOLDINVERSE_H
 
+#include <iostream>
 #include <mili/mili.h>
 #include <biopp/biopp.h>
 #include "fideo/IStartProvider.h"
@@ -37,6 +38,21 @@ namespace fideo
 struct InverseFoldParams;
 class IStartProvider;
 
+/**
+ * Limits of the search for designs. The attempts count the backend
+ * runs and the time is measured from the moment the budget is set.
+ * A zero means no limit.
+ */
+struct DesignBudget
+{
+    DesignBudget(size_t attempts = 0, double seconds = 0)
+        : attempts(attempts),
+          seconds(seconds)
+    {}
+    size_t attempts;
+    double seconds;
+};
+
 /**
  * Interface for sequence's inverse folding services.
  */
@@ -55,6 +71,8 @@ struct IFoldInverse
     virtual void fold_inverse(biopp::NucSequence&, const Temperature temp = 37) = 0;
     /**
      * Sets the start sequence for the backend.
+     * Ambiguous bases are not supported: throws UnsupportedException
+     * unless all the bases are A, C, G and U (or T).
      * @param seq the NucSequence.
      */
     virtual void set_start(const biopp::NucSequence&) = 0;
@@ -66,21 +84,87 @@ struct IFoldInverse
      */
     virtual void query_start(IStartProvider*) = 0;
 
+    /**
+     * Limits the search of the following fold_inverse calls, which throw
+     * DesignBudgetExhausted once the budget is spent.
+     * @param budget attempts and time allowed from now on.
+     */
+    virtual void set_budget(const DesignBudget& budget) = 0;
+
+    /**
+     * Writes the design state (start, designs found, free positions and
+     * pending candidates) to a binary snapshot.
+     * @param out stream to write to, opened in binary mode.
+     */
+    virtual void save_state(std::ostream& out) const = 0;
+
+    /**
+     * Resumes from a snapshot written by save_state for the same target
+     * structure, instead of setting a start. Throws InvalidDesignSnapshot.
+     * @param in stream to read from, opened in binary mode.
+     */
+    virtual void load_state(std::istream& in) = 0;
+
     virtual ~IFoldInverse() {}
 };
 
 struct InverseFoldParams
 {
-    InverseFoldParams(const biopp::SecStructure& structure, Similitude sd, Distance hd, CombinationAttempts ca)
+    InverseFoldParams(const biopp::SecStructure& structure, Similitude sd, Distance hd, CombinationAttempts ca, size_t pa = 1, size_t dr = 1, size_t ed = 0, Distance dd = 0, bool vf = false)
         : structure(structure),
           sd(sd),
           hd(hd),
-          ca(ca)
+          ca(ca),
+          pa(pa),
+          dr(dr),
+          ed(ed),
+          dd(dd),
+          vf(vf)
+    {}
+    /**
+     * The same parameters, for another structure.
+     */
+    InverseFoldParams(const biopp::SecStructure& structure, const InverseFoldParams& other)
+        : structure(structure),
+          sd(other.sd),
+          hd(other.hd),
+          ca(other.ca),
+          pa(other.pa),
+          dr(other.dr),
+          ed(other.ed),
+          dd(other.dd),
+          vf(other.vf)
     {}
     const biopp::SecStructure& structure;
     const Similitude sd;
     const Distance hd;
     const CombinationAttempts ca;
+    /**
+     * Number of backend runs launched concurrently for each attempt.
+     * The first novel candidate wins and the remaining runs are killed.
+     */
+    const size_t pa;
+    /**
+     * Number of designs requested to each backend run, for the backends
+     * that support it. The extra designs are kept for later calls.
+     */
+    const size_t dr;
+    /**
+     * Number of designs expected from the campaign. When given, room for
+     * them is reserved and a Bloom pre-check speeds up the novelty checks.
+     */
+    const size_t ed;
+    /**
+     * Minimum diversity of the designs: a candidate within this Hamming
+     * distance of a previous design is rejected. 0 only rejects repeats.
+     */
+    const Distance dd;
+    /**
+     * Whether to fold each candidate in-process at the requested
+     * temperature, rejecting it if its structure is farther than sd
+     * from the target, before returning it.
+     */
+    const bool vf;
 };
 
 } //namespace fideo
@@ -0,0 +1,106 @@
+/*
+ * @file     ILocalFold.h
+ * @brief    Interface for local (span limited) folding services.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing struct ILocalFold.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef ILOCAL_FOLD_H
+#define ILOCAL_FOLD_H
+
+#include <vector>
+#include <biopp/biopp.h>
+#include <mili/mili.h>
+#include "fideo/RnaBackendsTypes.h"
+#include "fideo/FideoHelper.h"
+#include "fideo/PackedStructure.h"
+
+namespace fideo
+{
+
+/** @brief A structure found in a window of a longer sequence
+ *
+ * Positions of the structure are relative to start.
+ */
+struct LocalStructure
+{
+    /** @brief First position of the structure in the sequence, 0-based */
+    size_t start;
+
+    /** @brief Structure of the window, kept packed */
+    PackedStructure structure;
+
+    /** @brief Free energy of the structure */
+    Fe energy;
+};
+
+/** @brief Interface for local folding services
+ *
+ * Folds long sequences (mRNAs, genomes) allowing only base pairs
+ * spanning at most a given amount of nucleotides, so the cost grows
+ * linearly with the length of the sequence instead of cubically.
+ * Each call runs the backend once over the whole sequence.
+ */
+struct ILocalFold
+{
+    typedef mili::FactoryRegistry<ILocalFold, std::string> Factory;
+
+    /** @brief Find the locally stable structures of a sequence
+     *
+     * @param sequence: the RNA sequence to fold.
+     * @param span: maximum distance between the bases of a pair.
+     * @param structures: to fill with the local structures, by start.
+     * @param temp: temperature to fold. By default is 37 grades.
+     * @return The minimum free energy of the whole sequence.
+     */
+    virtual Fe foldLocal(const biopp::NucSequence& sequence, const size_t span, std::vector<LocalStructure>& structures, const Temperature temp = 37) = 0;
+
+    /** @brief Probability of each position of being paired
+     *
+     * Probabilities are averaged over all the windows containing the
+     * position.
+     * @param sequence: the RNA sequence to fold.
+     * @param window: size of the windows, not lower than span.
+     * @param span: maximum distance between the bases of a pair.
+     * @param paired: to fill with one probability per position.
+     * @param temp: temperature to fold. By default is 37 grades.
+     * @return void
+     */
+    virtual void pairingProbabilities(const biopp::NucSequence& sequence, const size_t window, const size_t span, std::vector<Probability>& paired, const Temperature temp = 37) = 0;
+
+    /** @brief Class destructor
+     *
+     */
+    virtual ~ILocalFold() {}
+};
+
+} //namespace fideo
+
+#endif  /* ILOCAL_FOLD_H */
@@ -34,9 +34,91 @@
 #ifndef _IMOTIF_OBSERVER_H
 #define _IMOTIF_OBSERVER_H
 
+#include <string>
+#include <stdint.h>
+
 namespace fideo
 {
 
+/** @brief constant that represents motif name
+ *
+ */
+static const std::string EXTERNAL_LOOP = "External loop";
+static const std::string INTERIOR_LOOP = "Interior loop";
+static const std::string HAIRPIN_LOOP  = "Hairpin loop";
+static const std::string MULTI_LOOP    = "Multi-loop";
+static const std::string BULGE_LOOP    = "Bulge loop";
+
+/** @brief constant that represents specific interior loop
+ *
+ */
+static const std::string ASYMMETRIC = "Interior Asymmetric";
+static const std::string SYMMETRIC = "Interior Symmetric";
+
+/** @brief Kinds of the motifs, one per motif name
+ *
+ */
+enum MotifKind
+{
+    MotifExternalLoop,
+    MotifHairpinLoop,
+    MotifBulgeLoop,
+    MotifInteriorSymmetric,
+    MotifInteriorAsymmetric,
+    MotifMultiLoop,
+    MotifKinds                  /// amount of kinds, not a kind
+};
+
+/** @brief Name of a kind of motif
+ *
+ * Literals, not the constants above: those have internal linkage, and
+ * an inline function must not refer to them.
+ * @param kind: the kind
+ * @return the motif name, equal to its constant
+ */
+inline const char* motifName(const MotifKind kind)
+{
+    static const char* const NAMES[MotifKinds] =
+    {
+        "External loop", "Hairpin loop", "Bulge loop", "Interior Symmetric", "Interior Asymmetric", "Multi-loop"
+    };
+    return NAMES[kind];
+}
+
+/** @brief Kind of a motif name
+ *
+ * @param name: one of the motif names
+ * @param kind: to fill with the kind
+ * @return false if the name is not a motif name
+ */
+inline bool motifKind(const std::string& name, MotifKind& kind)
+{
+    for (size_t i = 0; i < MotifKinds; ++i)
+    {
+        if (motifName(MotifKind(i)) == name)
+        {
+            kind = MotifKind(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+/** @brief Compact motif, without strings
+ *
+ * first and last are the bases of the pair closing the loop, or the
+ * ends of the structure for the external loop; both are 0 when the
+ * source does not give them.
+ */
+struct MotifRecord
+{
+    uint32_t first;
+    uint32_t last;
+    uint32_t attribute;
+    uint32_t amountStacks;
+    uint8_t kind;               /// a MotifKind
+};
+
 /** @brief Interface for process motif services.
  *
  */
@@ -65,6 +147,27 @@ struct IMotifObserver
      */
     virtual void processMotif(const Motif& Motif) = 0;
 
+    /** @brief Processes all the motifs of a structure at once
+     *
+     * Sources call it once per structure. By default each record is
+     * passed to processMotif; observers that only count motifs should
+     * override it to avoid building a Motif for each one.
+     * @param first: first record
+     * @param last: one past the last record
+     * @return void
+     */
+    virtual void processMotifs(const MotifRecord* first, const MotifRecord* last)
+    {
+        Motif motif;
+        for (const MotifRecord* record = first; record != last; ++record)
+        {
+            motif.nameMotif = motifName(MotifKind(record->kind));
+            motif.attribute = record->attribute;
+            motif.amountStacks = record->amountStacks;
+            processMotif(motif);
+        }
+    }
+
     /** @brief Finalize observer
      *
      * @return void
@@ -0,0 +1,102 @@
+/*
+ * @file     IPartitionFunction.h
+ * @brief    Interface for partition function services.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing struct IPartitionFunction.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef IPARTITION_FUNCTION_H
+#define IPARTITION_FUNCTION_H
+
+#include <vector>
+#include <stdint.h>
+#include <biopp/biopp.h>
+#include <mili/mili.h>
+#include "fideo/RnaBackendsTypes.h"
+
+namespace fideo
+{
+
+/** @brief Probability of a base pair in the ensemble
+ *
+ * Plain 12 byte record: a list of them can be stored or sent as-is.
+ */
+struct PairProbability
+{
+    /** @brief Opening position of the pair, 0-based */
+    uint32_t first;
+
+    /** @brief Closing position of the pair, 0-based, greater than first */
+    uint32_t second;
+
+    /** @brief Probability of the pair */
+    float probability;
+};
+
+/** @brief Interface for partition function services
+ *
+ * Computes the free energy of the whole ensemble of structures of a
+ * sequence and the probability of its base pairs. Only the pairs above
+ * a threshold are reported, so the output grows with the amount of
+ * likely pairs instead of with the square of the length.
+ */
+struct IPartitionFunction
+{
+    typedef mili::FactoryRegistry<IPartitionFunction, std::string> Factory;
+
+    /** @brief Free energy of the ensemble, skipping the probabilities
+     *
+     * @param sequence: the RNA sequence.
+     * @param isCirc: if the sequence it's circular.
+     * @param temp: temperature to fold. By default is 37 grades.
+     * @return The free energy of the ensemble.
+     */
+    virtual Fe ensembleEnergy(const biopp::NucSequence& sequence, const bool isCirc, const Temperature temp = 37) = 0;
+
+    /** @brief Probabilities of the base pairs of a sequence
+     *
+     * @param sequence: the RNA sequence.
+     * @param isCirc: if the sequence it's circular.
+     * @param threshold: report only the pairs with a greater probability.
+     * @param pairs: to fill with the pairs, by first and then by second.
+     * @param temp: temperature to fold. By default is 37 grades.
+     * @return The free energy of the ensemble.
+     */
+    virtual Fe pairProbabilities(const biopp::NucSequence& sequence, const bool isCirc, const Probability threshold, std::vector<PairProbability>& pairs, const Temperature temp = 37) = 0;
+
+    /** @brief Class destructor
+     *
+     */
+    virtual ~IPartitionFunction() {}
+};
+
+} //namespace fideo
+
+#endif  /* IPARTITION_FUNCTION_H */
@@ -28,6 +28,7 @@
 
 #include <string>
 
+#include <vector>
 #include <mili/mili.h>
 #include <biopp/biopp.h>
 #include "fideo/RnaBackendsTypes.h"
@@ -50,6 +51,25 @@ struct IStructureCmp
      */
     virtual Similitude compare(const biopp::SecStructure& struct1, const biopp::SecStructure& struct2) const = 0;
 
+    /**
+     * Compare every pair of a set of structures.
+     * Calls compare for each pair, unless the backend has a batch mode.
+     * @param structures the structures to compare.
+     * @param upper to fill with the similitudes of the pairs i < j, by
+     *        rows, as in SimilarityMatrix.
+     */
+    virtual void compareAll(const std::vector<biopp::SecStructure>& structures, std::vector<Similitude>& upper) const
+    {
+        upper.clear();
+        for (size_t i = 0; i < structures.size(); ++i)
+        {
+            for (size_t j = i + 1; j < structures.size(); ++j)
+            {
+                upper.push_back(compare(structures[i], structures[j]));
+            }
+        }
+    }
+
     virtual ~IStructureCmp() {}
 };
 
@@ -0,0 +1,102 @@
+/*
+ * @file     ISuboptimalFold.h
+ * @brief    Interface for suboptimal structure enumeration services.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing struct ISuboptimalFold.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef ISUBOPTIMAL_FOLD_H
+#define ISUBOPTIMAL_FOLD_H
+
+#include <biopp/biopp.h>
+#include <mili/mili.h>
+#include "fideo/RnaBackendsTypes.h"
+#include "fideo/PackedStructure.h"
+
+namespace fideo
+{
+
+/** @brief A structure of the energy band of a sequence
+ *
+ */
+struct Suboptimal
+{
+    /** @brief Structure found, kept packed */
+    PackedStructure structure;
+
+    /** @brief Free energy of the structure */
+    Fe energy;
+};
+
+/** @brief Interface for suboptimal structure enumeration services
+ *
+ * Structures are read from the backend while it is still enumerating
+ * them, in the order it finds them (not sorted by energy). Stopping,
+ * explicitly or by reaching the maximum count, kills the backend at
+ * once, so a bounded query does not pay for the whole band.
+ * One enumeration at a time per instance.
+ */
+struct ISuboptimalFold
+{
+    typedef mili::FactoryRegistry<ISuboptimalFold, std::string> Factory;
+
+    /** @brief Start enumerating, stopping any previous enumeration
+     *
+     * @param sequence: the RNA sequence to fold.
+     * @param isCirc: if the sequence it's circular.
+     * @param range: energy band above the minimum free energy.
+     * @param maxCount: maximum amount of structures to read, 0 for no limit.
+     * @param temp: temperature to fold. By default is 37 grades.
+     * @return The minimum free energy.
+     */
+    virtual Fe start(const biopp::NucSequence& sequence, const bool isCirc, const Fe range, const size_t maxCount, const Temperature temp = 37) = 0;
+
+    /** @brief Read the next structure
+     *
+     * @param suboptimal: to fill with the structure read.
+     * @return false when the enumeration finished or was stopped.
+     */
+    virtual bool next(Suboptimal& suboptimal) = 0;
+
+    /** @brief Stop the enumeration, killing the backend if still running
+     *
+     * @return void
+     */
+    virtual void stop() = 0;
+
+    /** @brief Class destructor
+     *
+     */
+    virtual ~ISuboptimalFold() {}
+};
+
+} //namespace fideo
+
+#endif  /* ISUBOPTIMAL_FOLD_H */
@@ -0,0 +1,82 @@
+/*
+ * @file     LoopDecomposition.h
+ * @brief    Decomposition of secondary structures in loops.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing the loop decomposition.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#ifndef LOOP_DECOMPOSITION_H
+#define LOOP_DECOMPOSITION_H
+
+#include <vector>
+#include <biopp/biopp.h>
+#include "fideo/IMotifObserver.h"
+
+namespace fideo
+{
+
+/** @brief Reports the loops of a structure as motifs
+ *
+ * Computes from the pairs alone the motifs that UNAFold reports in
+ * its .det files, so that any backend can feed a motif observer:
+ * - External loop: attribute is its unpaired bases.
+ * - Hairpin loop: attribute is the distance between the closing bases.
+ * - Bulge loop: attribute is the distance between the pairs on the
+ *   side of the bulge.
+ * - Interior Symmetric and Interior Asymmetric: attribute is the
+ *   longest distance between the pairs at each side.
+ * - Multi-loop: attribute is its unpaired bases.
+ * amountStacks is the amount of stacked pairs of the helices that
+ * branch from the loop, so each stack is counted once.
+ *
+ * The external loop comes first, then the loops closed by each pair
+ * in 5' to 3' order of their opening bases.
+ * Runs in time linear in the size of the structure and without
+ * recursion.
+ * @param structure: a pseudoknot free structure
+ * @param records: to fill with the motifs, reusing its storage
+ * @return void
+ */
+void decomposeLoops(const biopp::SecStructure& structure, std::vector<MotifRecord>& records);
+
+/** @brief Reports the loops of a structure to an observer
+ *
+ * The motifs go in one call to processMotifs. finalize() is not
+ * called, so several structures can be reported to the same observer.
+ * @param structure: a pseudoknot free structure
+ * @param observer: to receive the motifs
+ * @return void
+ */
+void decomposeLoops(const biopp::SecStructure& structure, IMotifObserver& observer);
+
+} //namespace fideo
+
+#endif  /* LOOP_DECOMPOSITION_H */
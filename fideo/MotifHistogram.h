@@ -0,0 +1,156 @@
+/*
+ * @file     MotifHistogram.h
+ * @brief    Motif statistics kept in flat histograms.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing class MotifHistogram.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#ifndef MOTIF_HISTOGRAM_H
+#define MOTIF_HISTOGRAM_H
+
+#include <vector>
+#include <algorithm>
+#include <stdint.h>
+#include "fideo/IMotifObserver.h"
+
+namespace fideo
+{
+
+/** @brief Observer that counts motifs by kind, attribute and stacks
+ *
+ * Counts live in flat arrays, one row per kind; values beyond the
+ * last bin are counted in the last bin. Every structure is one
+ * processMotifs() call, as sources make one per structure; motifs
+ * given one by one to processMotif() are not a structure.
+ *
+ * Not thread safe: give each thread its own histogram, with the
+ * same bins, and merge them when the threads are done.
+ */
+class MotifHistogram : public IMotifObserver
+{
+public:
+    /** @brief Represent the counts
+     *
+     */
+    typedef uint64_t Count;
+
+    /** @brief Constructor of class
+     *
+     * @param attributeBins: amount of bins for the attributes
+     * @param stacksBins: amount of bins for the stack counts
+     */
+    MotifHistogram(const size_t attributeBins = DEFAULT_BINS, const size_t stacksBins = DEFAULT_BINS);
+
+    virtual void start();
+    virtual void processMotif(const Motif& motif);
+    virtual void processMotifs(const MotifRecord* first, const MotifRecord* last);
+    virtual void finalize();
+
+    /** @brief Add the counts of another histogram
+     *
+     * @param other: histogram with the same bins
+     * @return void
+     */
+    void merge(const MotifHistogram& other);
+
+    /** @brief Forget all the counts
+     *
+     * @return void
+     */
+    void clear();
+
+    /** @brief Amount of structures seen
+     *
+     */
+    Count structures() const
+    {
+        return _structures;
+    }
+
+    /** @brief Amount of motifs of a kind
+     *
+     */
+    Count motifs(const MotifKind kind) const
+    {
+        return _motifs[kind];
+    }
+
+    /** @brief Amount of motifs of a kind with an attribute
+     *
+     * @param kind: kind of the motifs
+     * @param bin: attribute, the last bin counts the greater ones too
+     */
+    Count attributes(const MotifKind kind, const size_t bin) const
+    {
+        return _attributes[kind * _attributeBins + bin];
+    }
+
+    /** @brief Amount of motifs of a kind with a stack count
+     *
+     * @param kind: kind of the motifs
+     * @param bin: stack count, the last bin counts the greater ones too
+     */
+    Count stacks(const MotifKind kind, const size_t bin) const
+    {
+        return _stacks[kind * _stacksBins + bin];
+    }
+
+    size_t attributeBins() const
+    {
+        return _attributeBins;
+    }
+
+    size_t stacksBins() const
+    {
+        return _stacksBins;
+    }
+
+    static const size_t DEFAULT_BINS = 64;
+
+private:
+    void add(const MotifKind kind, const size_t attribute, const size_t amountStacks)
+    {
+        ++_motifs[kind];
+        ++_attributes[kind * _attributeBins + std::min(attribute, _attributeBins - 1)];
+        ++_stacks[kind * _stacksBins + std::min(amountStacks, _stacksBins - 1)];
+    }
+
+    const size_t _attributeBins;
+    const size_t _stacksBins;
+    Count _structures;
+    std::vector<Count> _motifs;
+    std::vector<Count> _attributes;
+    std::vector<Count> _stacks;
+};
+
+} //namespace fideo
+
+#endif  /* MOTIF_HISTOGRAM_H */
@@ -0,0 +1,185 @@
+/*
+ * @file     PackedSequence.h
+ * @brief    Provides a compact 2-bit representation of nucleotide sequences.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing class PackedSequence.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#ifndef PACKED_SEQUENCE_H
+#define PACKED_SEQUENCE_H
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include "fideo/RnaBackendsException.h"
+
+namespace fideo
+{
+
+/** @brief Nucleotide sequence stored using 2 bits per base, 32 bases per word
+ *
+ * Case is ignored and T and U share the same code, so "ACGT" and "acgu"
+ * pack to the same value. Unused bits of the last word are always zero.
+ */
+class PackedSequence
+{
+public:
+
+    /** @brief Represent the packed words
+     *
+     */
+    typedef std::vector<uint64_t> Words;
+
+    /** @brief Constructor of class
+     *
+     */
+    PackedSequence();
+
+    /** @brief Constructor of class, packing a sequence
+     *
+     * @param sequence: string composed of A, C, G, T or U in any case
+     */
+    explicit PackedSequence(const std::string& sequence);
+
+    /** @brief Pack a sequence
+     *
+     * @param sequence: string composed of A, C, G, T or U in any case
+     * @return void
+     */
+    void pack(const std::string& sequence);
+
+    /** @brief Load an already packed sequence
+     *
+     * @param words: packed words, at least wordsFor(bases) long
+     * @param bases: amount of bases in the sequence
+     * @return void
+     */
+    void assign(const uint64_t* words, const size_t bases);
+
+    /** @brief Decode the sequence, in lowercase and using 'u'
+     *
+     * @param sequence: to fill with the decoded sequence
+     * @return void
+     */
+    void unpack(std::string& sequence) const;
+
+    /** @brief Amount of bases in the sequence
+     *
+     */
+    size_t size() const
+    {
+        return _bases;
+    }
+
+    /** @brief Packed words
+     *
+     */
+    const Words& words() const
+    {
+        return _words;
+    }
+
+    /** @brief Hash of the length and packed words
+     *
+     */
+    uint64_t hash() const;
+
+    /** @brief Amount of positions where two sequences differ
+     *
+     * @param other: a sequence of the same size
+     * @return the Hamming distance
+     */
+    size_t hamming(const PackedSequence& other) const;
+
+    /** @brief Hamming distance between packed words
+     *
+     * XORs the words and counts the codes with any bit set, 32 bases at a time.
+     * The count uses the popcount instruction when the processor has it
+     * (checked at run time), or branch free arithmetic otherwise.
+     * @param a: packed words of a sequence
+     * @param b: packed words of a sequence of the same size
+     * @param words: amount of words of each sequence
+     * @return the Hamming distance
+     */
+    static size_t hamming(const uint64_t* a, const uint64_t* b, const size_t words);
+
+    /** @brief One bit per differing base of two packed words
+     *
+     * Each bit is alone in the 2 bits field of its base, so a popcount
+     * of the result is the amount of differing bases.
+     */
+    static uint64_t differingBases(const uint64_t a, const uint64_t b)
+    {
+        const uint64_t diff = a ^ b;
+        return (diff | (diff >> 1)) & LOW_BITS;
+    }
+
+    /** @brief Amount of differing bases of two packed words, without popcount
+     *
+     * Branch free arithmetic; the bits are already alone in pairs, so the
+     * first step of the count is skipped.
+     */
+    static size_t differingBasesArithmetic(const uint64_t a, const uint64_t b)
+    {
+        uint64_t count = differingBases(a, b);
+        count = (count & 0x3333333333333333ULL) + ((count >> 2) & 0x3333333333333333ULL);
+        count = (count + (count >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return size_t((count * 0x0101010101010101ULL) >> 56);
+    }
+
+    bool operator==(const PackedSequence& other) const
+    {
+        return _bases == other._bases && _words == other._words;
+    }
+
+    /** @brief Amount of words required to pack a sequence
+     *
+     * @param bases: amount of bases in the sequence
+     * @return words required
+     */
+    static size_t wordsFor(const size_t bases)
+    {
+        return (bases + BASES_PER_WORD - 1) / BASES_PER_WORD;
+    }
+
+    static const size_t BASES_PER_WORD = 32;
+    static const size_t BITS_PER_BASE = 2;
+    static const uint64_t LOW_BITS = 0x5555555555555555ULL;
+
+private:
+
+    size_t _bases;
+    Words _words;
+};
+
+} //namespace fideo
+
+#endif  /* PACKED_SEQUENCE_H */
@@ -0,0 +1,152 @@
+/*
+ * @file     PackedStructure.h
+ * @brief    Provides a compact 2-bit representation of secondary structures.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing class PackedStructure.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef PACKED_STRUCTURE_H
+#define PACKED_STRUCTURE_H
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <biopp/biopp.h>
+#include "fideo/RnaBackendsException.h"
+
+namespace fideo
+{
+
+/** @brief Secondary structure stored as a dot-bracket string using 2 bits per position
+ *
+ * Only nested (pseudoknot free) structures can be represented.
+ */
+class PackedStructure
+{
+public:
+
+    /** @brief Represent the packed bytes
+     *
+     */
+    typedef std::vector<uint8_t> Bytes;
+
+    /** @brief Constructor of class
+     *
+     */
+    PackedStructure();
+
+    /** @brief Pack a secondary structure
+     *
+     * @param structure: structure to pack
+     * @return void
+     */
+    void pack(const biopp::SecStructure& structure);
+
+    /** @brief Pack a structure given in dot-bracket notation
+     *
+     * @param dotBracket: string composed of '.', '(' and ')'
+     * @return void
+     */
+    void pack(const std::string& dotBracket);
+
+    /** @brief Load an already packed structure
+     *
+     * @param data: packed bytes, at least bytesFor(positions) long
+     * @param positions: amount of positions in the structure
+     * @return void
+     */
+    void assign(const uint8_t* data, const size_t positions);
+
+    /** @brief Decode the structure
+     *
+     * @param structure: to fill with the decoded structure
+     * @return void
+     */
+    void unpack(biopp::SecStructure& structure) const;
+
+    /** @brief Decode the structure to dot-bracket notation
+     *
+     * @param dotBracket: to fill with the decoded structure
+     * @return void
+     */
+    void toString(std::string& dotBracket) const;
+
+    /** @brief Amount of positions in the structure
+     *
+     */
+    size_t size() const
+    {
+        return _positions;
+    }
+
+    /** @brief Packed bytes
+     *
+     */
+    const Bytes& bytes() const
+    {
+        return _bytes;
+    }
+
+    /** @brief Amount of bytes required to pack a structure
+     *
+     * @param positions: amount of positions in the structure
+     * @return bytes required
+     */
+    static size_t bytesFor(const size_t positions)
+    {
+        return (positions + SYMBOLS_PER_BYTE - 1) / SYMBOLS_PER_BYTE;
+    }
+
+private:
+
+    /** @brief Represents the symbols of the dot-bracket notation
+     *
+     */
+    enum Symbol
+    {
+        SymbolUnpaired,
+        SymbolOpen,
+        SymbolClose
+    };
+
+    static const size_t SYMBOLS_PER_BYTE = 4;
+    static const size_t BITS_PER_SYMBOL = 2;
+
+    void reset(const size_t positions);
+    void set(const size_t pos, const Symbol symbol);
+    Symbol get(const size_t pos) const;
+
+    size_t _positions;
+    Bytes _bytes;
+};
+
+} //namespace fideo
+
+#endif  /* PACKED_STRUCTURE_H */
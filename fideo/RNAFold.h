@@ -56,39 +56,15 @@ private:
     virtual void deleteAllFilesAfterProcessing(const InputFile& inFile, const OutputFile& outFile);
     virtual void deleteObsoleteFiles(const InputFile& inFile);
     virtual void renameNecessaryFiles(const std::string& fileToRename, const std::string& newNameFile);
+    virtual void prepareEnergyData(const biopp::NucSequence& sequence, const bool isCirc, etilico::Command& command, InputFile& inputFile, OutputFile& outputFile, const Temperature temp = 37);
+    virtual void processingEnergy(const OutputFile& outputFile, Fe& freeEnergy);
+    virtual void deleteFilesAfterEnergy(const InputFile& inFile, const OutputFile& outFile);
+    virtual void processingRawResult(const InputFile& inputFile, PackedStructure& structure, Fe& freeEnergy);
 
     /** @brief Destructor of class
      *
      */
     virtual ~RNAFold() {}
-
-    /** @brief Read free energy of line
-     *
-     * @param file: to read
-     * @param energy: to fill with free energy
-     * @return index of first ")" in file
-     */
-    size_t readFreeEnergy(FileLine& file, size_t offset, Fe& energy) const;
-
-    /** @brief Obtain secondary structure
-     *
-     * @param str: to parse
-     * @param secStrucute: to fill with structure
-     * @return void
-     */
-    static void parseStructure(std::string& str, biopp::SecStructure& secStructure);
-
-    /** @brief Gets the size of the folded sequence from a file
-     *
-     * @param file: input file to read
-     * @return size of sequence
-     */
-    size_t getSizeOfSequence(const FilePath& file) const;
-
-    static const FileLineNo LINE_NO;
-    static const char OPEN_PAIR = '(';
-    static const char CLOSE_PAIR = ')';
-    static const char UNPAIR = '.';
 };
 
 } //namespace fideo
@@ -0,0 +1,131 @@
+/*
+ * @file     RNAFoldOutputParser.h
+ * @brief    Provides a single pass parser of RNAfold output.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing class RNAFoldOutputParser.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef RNA_FOLD_OUTPUT_PARSER_H
+#define RNA_FOLD_OUTPUT_PARSER_H
+
+#include <string>
+#include "fideo/RnaBackendsTypes.h"
+#include "fideo/RnaBackendsException.h"
+
+namespace fideo
+{
+
+/** @brief Represents the result of a sequence in the RNAfold output
+ *
+ */
+struct RNAFoldRecord
+{
+    std::string name;       /// FASTA header without '>', empty if the input had none
+    std::string sequence;
+    std::string structure;  /// dot-bracket notation
+    Fe energy;
+};
+
+/** @brief Parses RNAfold output held in a buffer, record by record, in one pass
+ *
+ * The output of each sequence looks like:
+ *
+ *     >name                              (only when the input had a header)
+ *     AAAAAAAAGGGGGGGGCCCCCCCCUUUUUUUU
+ *     ..((((((((((((....)))))))))))).. (-13.60)
+ *
+ * Any extra line printed for a record (e.g. the ensemble lines of -p) is skipped.
+ * The buffer is not copied, so it must outlive the parser, and it must be followed
+ * by a non numeric char (as the data of a std::string is).
+ */
+class RNAFoldOutputParser
+{
+public:
+
+    /** @brief Constructor of class
+     *
+     * @param begin: first char of the output
+     * @param end: past the last char of the output
+     */
+    RNAFoldOutputParser(const char* begin, const char* end);
+
+    /** @brief Parse the next record
+     *
+     * @param record: to fill with the record
+     * @return false if there are no more records
+     */
+    bool next(RNAFoldRecord& record);
+
+    /** @brief Parse the next record, reading only its free energy
+     *
+     * @param energy: to fill with the free energy
+     * @return false if there are no more records
+     */
+    bool nextEnergy(Fe& energy);
+
+private:
+
+    /** @brief Position the cursor at the first line of the next record
+     *
+     * @param name: to fill with the header of the record, if any
+     * @return false if there are no more records
+     */
+    bool seekRecord(std::string* name);
+
+    /** @brief Get the current line and advance to the next one
+     *
+     */
+    void takeLine(const char*& line, const char*& lineEnd);
+
+    /** @brief Read the sequence and structure lines of a record
+     *
+     * @param structure: to point to the first char of the structure
+     * @param length: to fill with the sequence length
+     * @param energy: to fill with the free energy
+     * @param sequence: to fill with the sequence, if not NULL
+     * @return void
+     */
+    void parseRecord(const char*& structure, size_t& length, Fe& energy, std::string* sequence);
+
+    /** @brief Read the free energy enclosed in parenthesis
+     *
+     * @param from: first char after the structure
+     * @param lineEnd: end of the structure line
+     * @return the free energy
+     */
+    static Fe parseEnergy(const char* from, const char* lineEnd);
+
+    const char* _cursor;
+    const char* const _end;
+};
+
+} //namespace fideo
+
+#endif  /* RNA_FOLD_OUTPUT_PARSER_H */
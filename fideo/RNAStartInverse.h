@@ -27,13 +27,22 @@
 #define _RNASTARTINVERSE_H
 
 #include <string>
+#include <list>
+#include <chrono>
+#include <atomic>
+#include <etilico/etilico.h>
 #include "fideo/RnaBackendsTypes.h"
+#include "fideo/ChildProcess.h"
+#include "fideo/SequenceSet.h"
+#include "fideo/DiversityFilter.h"
 #include "fideo/IFoldInverse.h"
 #include "fideo/Combinator.h"
 
 namespace fideo
 {
 
+class ViennaFolder;
+
 /**
  * Base class implementation for RNA inverse folding
  * backends that accept a start sequence.
@@ -42,6 +51,20 @@ namespace fideo
  * This class takes care of avoid repeated sequences
  * and change the free positions in the start sequence
  * when the attempts for each combination it's reached.
+ *
+ * Each attempt may launch several backend runs concurrently
+ * (see InverseFoldParams::pa); the first run that yields a
+ * novel candidate wins and the other runs are killed.
+ *
+ * Backends may yield several candidates per run (see
+ * InverseFoldParams::dr); the ones not used are buffered and
+ * drained by the next calls while the start does not change.
+ *
+ * Candidates can be folded in-process at the requested temperature
+ * (see InverseFoldParams::vf) and dropped if they miss the target.
+ *
+ * The design state can be saved to a snapshot and loaded by a
+ * later process, which resumes the search where it was left.
  */
 
 class RNAStartInverse : public IFoldInverse
@@ -62,33 +85,166 @@ public:
 private:
 
     static const char WILDCARD = 'N';
+    static const size_t BLOOM_BITS_PER_DESIGN = 10;
     std::string rstart;
-    StringSequencesCt found;
+    SequenceSet found;
+    DiversityFilter diverse;
     const CombinationAttempts combination_attempts;
+    const size_t parallel_attempts;
+    const bool verify;
     SeqIndexesCombinator* const combinator;
     SeqIndexesCombination positions;
+    DesignBudget budget;
+    std::atomic<size_t> spent_attempts;
+    std::chrono::steady_clock::time_point deadline;
 
     virtual void fold_inverse(biopp::NucSequence&, const Temperature temp = 37);
     virtual void set_start(const biopp::NucSequence&);
+    virtual void set_budget(const DesignBudget&);
+    virtual void save_state(std::ostream&) const;
+    virtual void load_state(std::istream&);
+
+    /**
+     * Counts a new attempt against the budget: a serial run or each
+     * run of a parallel attempt. Called concurrently by the parallel runs.
+     * Throws DesignBudgetExhausted if there is none left.
+     */
+    void spend_attempt();
+
+    /**
+     * Whether the time of the budget is over. Runs in progress
+     * are told to give up through RunControl::cancelled().
+     */
+    bool out_of_time() const;
 
     void change_start();
-    
+
+    /**
+     * Whether a candidate was not found before and is
+     * not within the diversity distance of a design.
+     */
+    bool is_novel(const std::string& seq) const;
+
+    /**
+     * When verify is set, whether the structure of a candidate folded
+     * in-process is within max_structure_distance of the target.
+     * Called concurrently by the parallel runs, each with its own folder.
+     * @param seq    the candidate.
+     * @param folder folder of the calling thread at the temperature of the
+     *               design, built once per call to fold_inverse or per parallel
+     *               run; NULL when verify is not set.
+     */
+    bool is_verified(const std::string& seq, ViennaFolder* folder) const;
+
+    /**
+     * Takes candidates from the buffer, running the backend when it is
+     * empty, until one is within max_structure_distance.
+     * @param seq  to write the candidate.
+     * @param temp temperature to inverse fold.
+     * @param folder to verify the candidates, see is_verified.
+     * @return true if the candidate was not found before.
+     */
+    bool attempt(std::string& seq, const Temperature temp, ViennaFolder* folder);
+
+    /**
+     * Runs parallel_attempts backends concurrently until one of them
+     * yields a novel candidate within max_structure_distance, or all of
+     * them yield already found ones. The remaining candidates are buffered.
+     * @param seq  to write the candidate.
+     * @param temp temperature to inverse fold.
+     * @return true if a novel candidate was found.
+     */
+    bool parallel_attempt(std::string& seq, const Temperature temp);
+
+    /**
+     * Runs the backend once, appending its candidates to the buffer.
+     */
+    void execute(ChildProcess& process, const Temperature temp);
+
+    class SerialRun;
+    class ParallelAttempt;
+
+protected:
+
+    /**
+     * A sequence yielded by the backend.
+     */
+    struct Candidate
+    {
+        std::string seq;   ///< sequence found, in lowercase.
+        Distance hd;       ///< hamming distance between the start and found.
+        Similitude sd;     ///< structure distance between the found and target.
+    };
+    typedef std::list<Candidate> Candidates;
+
+    /**
+     * Gives a run access to its backend process and tells
+     * whether the attempt it belongs to was cancelled.
+     */
+    class RunControl
+    {
+    public:
+        /**
+         * Starts the backend process, unless the run was cancelled.
+         * @param cmd the command to run.
+         * @return false if the run was cancelled and nothing was started.
+         */
+        virtual bool start(const etilico::Command& cmd) = 0;
+
+        /**
+         * The process started by start().
+         */
+        virtual ChildProcess& process() = 0;
+
+        /**
+         * Whether another run already won, so this one should give up.
+         */
+        virtual bool cancelled() const = 0;
+
+        virtual ~RunControl() {}
+    };
+
+private:
+
+    Candidates candidates;
+
 protected:
 
     std::string start;
     const biopp::SecStructure structure;
     const Similitude max_structure_distance;
     const Distance max_sequence_distance;
+    const size_t designs_per_run;
+
+    /**
+     * Runs the backend once. Called concurrently, so it must not
+     * write to any member or fixed file.
+     * By default, starts the command given by get_command and
+     * reads its output with parse_output. Backends running
+     * in-process override it, polling control.cancelled().
+     * @param control to start the process and check for cancellation.
+     * @param found to append every candidate found.
+     * @param temp temperature to inverse fold.
+     */
+    virtual void generate(RunControl& control, Candidates& found, const Temperature temp) const;
+
+    /**
+     * To be implemented in the concrete backend running a command.
+     * Should build the command line that runs the backend algorithm
+     * writing its result to the standard output. Called concurrently,
+     * so it must not write to any member or fixed file.
+     * @param cmd  to write the command.
+     * @param temp temperature to inverse fold. By default is 37 grades.
+     */
+    virtual void get_command(etilico::Command& cmd, const Temperature temp = 37) const;
 
     /**
-     * To be implemented in the concrete backend.
-     * Should call the backend algorithm and parse the result correctly.
-     * @param seq  to write the sequence found.
-     * @param hd   to write the hamming distance between the start and found.
-     * @param sd   to write the structure distance between the found and target
-     * @param temp temperature to inverse fold. By default is 37 grades. 
+     * To be implemented in the concrete backend running a command.
+     * Should parse the output of the command correctly, in one pass.
+     * @param process the running backend, to read its output.
+     * @param found to append every candidate found, at least one.
      */
-    virtual void execute(std::string&, Distance&, Similitude&, const Temperature temp = 37) = 0;
+    virtual void parse_output(ChildProcess& process, Candidates& found) const;
 
 };
 
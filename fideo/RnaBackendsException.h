@@ -75,6 +75,12 @@ DEFINE_SPECIFIC_EXCEPTION_TEXT(InvalidBodyLine, FideoExceptionHierarchy, "Invali
 DEFINE_SPECIFIC_EXCEPTION_TEXT(InvalidaHeader, FideoExceptionHierarchy, "Invalid Header");
 DEFINE_SPECIFIC_EXCEPTION_TEXT(FailOperation, FideoExceptionHierarchy, "Failured operation >>");
 DEFINE_SPECIFIC_EXCEPTION_TEXT(CombinatorException, FideoExceptionHierarchy, "Combinator Exception");
+DEFINE_SPECIFIC_EXCEPTION_TEXT(InvalidResultStore, FideoExceptionHierarchy, "Invalid result store");
+DEFINE_SPECIFIC_EXCEPTION_TEXT(CorruptedResultRecord, FideoExceptionHierarchy, "Result record checksum mismatch");
+DEFINE_SPECIFIC_EXCEPTION_TEXT(InvalidFastaFile, FideoExceptionHierarchy, "Invalid FASTA file");
+DEFINE_SPECIFIC_EXCEPTION_TEXT(DesignBudgetExhausted, FideoExceptionHierarchy, "Design budget exhausted");
+DEFINE_SPECIFIC_EXCEPTION_TEXT(InvalidDesignSnapshot, FideoExceptionHierarchy, "Invalid design snapshot");
+DEFINE_SPECIFIC_EXCEPTION_TEXT(InvalidWindow, FideoExceptionHierarchy, "Window shorter than the base pair span");
 
 }// namespace fideo
 #endif  /* _RNA_BACKENDS_EXCEPTIONS_H */
@@ -75,6 +75,11 @@ typedef unsigned int CombinationAttempts;
  */
 typedef double Temperature;	
 
+/**
+ * Probability of an event in the structure ensemble.
+ */
+typedef double Probability;
+
 }
 
 #endif  /* _RNA_BACKENDS_TYPES_H */
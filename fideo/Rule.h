@@ -41,13 +41,13 @@ class UNAFold::DetFileParser::Rule
 {
 public:
 
-    /** @brief To calculate the attributes of a motif
+    /** @brief To calculate the kind and attributes of a motif
      *
      * @param block: input block
-     * @param motif: to fill with attributes of block
+     * @param record: to fill with the kind, attribute and stacks of block
      * @return void
      */
-    virtual void calculateAttrib(const Block& block, IMotifObserver::Motif& motif) const = 0;
+    virtual void calculateAttrib(const Block& block, MotifRecord& record) const = 0;
 
     /** @brief Destructor of class
      *
@@ -102,7 +102,7 @@ private:
     /** @brief Calculate the amount of ss bases on the block
      *
      */
-    virtual void calculateAttrib(const Block& block, IMotifObserver::Motif& motif) const;
+    virtual void calculateAttrib(const Block& block, MotifRecord& record) const;
     virtual ~ExternalRule() {}
 };
 
@@ -117,7 +117,7 @@ private:
      *          of interior loop (symmetric or asymmetric)
      *
     */
-    virtual void calculateAttrib(const Block& block, IMotifObserver::Motif& motif) const;
+    virtual void calculateAttrib(const Block& block, MotifRecord& record) const;
     virtual ~InteriorRule() {}
 };
 
@@ -131,7 +131,7 @@ private:
     /** @brief Calculate the amout of nucleotide on the hairpin loop
      *
      */
-    virtual void calculateAttrib(const Block& block, IMotifObserver::Motif& motif) const;
+    virtual void calculateAttrib(const Block& block, MotifRecord& record) const;
     virtual ~HairpinRule() {}
 };
 
@@ -145,7 +145,7 @@ private:
     /** @brief Calculate the amount of ss bases on the block
      *
      */
-    virtual void calculateAttrib(const Block& block, IMotifObserver::Motif& motif) const;
+    virtual void calculateAttrib(const Block& block, MotifRecord& record) const;
     virtual ~MultiRule() {}
 };
 
@@ -159,6 +159,6 @@ private:
     /** @brief Calculate the amount of nucleotide on the bulge loop
      *
      */
-    virtual void calculateAttrib(const Block& block, IMotifObserver::Motif& motif) const;
+    virtual void calculateAttrib(const Block& block, MotifRecord& record) const;
     virtual ~BulgeRule() {}
 };
@@ -0,0 +1,141 @@
+/*
+ * @file     SequenceSet.h
+ * @brief    Provides a compact hashed set of nucleotide sequences.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing class SequenceSet.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#ifndef SEQUENCE_SET_H
+#define SEQUENCE_SET_H
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include "fideo/PackedSequence.h"
+
+namespace fideo
+{
+
+/** @brief Set of sequences stored packed in a single arena, with O(1) lookups
+ *
+ * Sequences are kept as PackedSequence words in one contiguous vector and
+ * indexed by an open addressing table of 64-bit slots, so each design costs
+ * a quarter byte per base plus a couple of words. Optionally, a Bloom filter
+ * answers most lookups of new sequences without touching the table.
+ * Lookups are safe to run concurrently while the set is not modified.
+ */
+class SequenceSet
+{
+public:
+
+    /** @brief Constructor of class
+     *
+     * @param expected: amount of sequences expected, to reserve room for them
+     * @param bloomBitsPerSequence: size of the Bloom pre-check per expected sequence; 0 disables it
+     */
+    explicit SequenceSet(const size_t expected = 0, const size_t bloomBitsPerSequence = 0);
+
+    /** @brief Add a sequence
+     *
+     * @param sequence: string composed of A, C, G, T or U in any case
+     * @return true if it was not in the set
+     */
+    bool insert(const std::string& sequence);
+
+    /** @brief Add a packed sequence
+     *
+     * @param sequence: the packed sequence
+     * @return true if it was not in the set
+     */
+    bool insert(const PackedSequence& sequence);
+
+    /** @brief Determine whether a sequence is in the set
+     *
+     * @param sequence: string composed of A, C, G, T or U in any case
+     */
+    bool contains(const std::string& sequence) const;
+
+    /** @brief Determine whether a packed sequence is in the set
+     *
+     * @param sequence: the packed sequence
+     */
+    bool contains(const PackedSequence& sequence) const;
+
+    /** @brief Remove all the sequences, keeping the Bloom pre-check configuration
+     *
+     * @return void
+     */
+    void clear();
+
+    /** @brief Amount of sequences in the set
+     *
+     */
+    size_t size() const
+    {
+        return _size;
+    }
+
+    /** @brief Apply a functor to each sequence, in insertion order
+     *
+     * @param func: functor called with each const PackedSequence&
+     * @return void
+     */
+    template <class Func>
+    void forEach(Func& func) const;
+
+private:
+
+    typedef std::vector<uint64_t> Words;
+
+    bool find(const PackedSequence& sequence, const uint64_t hash, size_t& slot) const;
+    bool equals(const uint64_t offset, const PackedSequence& sequence) const;
+    void grow();
+    uint64_t hashAt(const uint64_t offset) const;
+    void bloomAdd(const uint64_t hash);
+    bool bloomMayContain(const uint64_t hash) const;
+
+    static const size_t INITIAL_SLOTS = 64;
+    static const size_t BLOOM_HASHES = 7;
+
+    Words _arena;           /// each sequence is its length followed by its packed words
+    Words _slots;           /// 0 if empty, otherwise the arena offset plus one
+    size_t _size;
+    Words _bloom;
+    size_t _bloomBits;
+};
+
+} //namespace fideo
+
+#define SEQUENCE_SET_INLINE_H
+#include "fideo/SequenceSetInline.h"
+#undef SEQUENCE_SET_INLINE_H
+
+#endif  /* SEQUENCE_SET_H */
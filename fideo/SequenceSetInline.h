@@ -0,0 +1,57 @@
+/*
+ * @file     SequenceSetInline.h
+ * @brief    Provides a compact hashed set of nucleotide sequences.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing the template members of SequenceSet.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#ifndef SEQUENCE_SET_INLINE_H
+#error Internal header file, DO NOT include this.
+#endif
+
+namespace fideo
+{
+
+template <class Func>
+inline void SequenceSet::forEach(Func& func) const
+{
+    PackedSequence sequence;
+    size_t offset = 0;
+    while (offset < _arena.size())
+    {
+        const size_t bases = size_t(_arena[offset]);
+        sequence.assign(&_arena[offset + 1], bases);
+        func(static_cast<const PackedSequence&>(sequence));
+        offset += 1 + PackedSequence::wordsFor(bases);
+    }
+}
+
+} //namespace fideo
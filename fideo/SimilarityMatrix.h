@@ -0,0 +1,126 @@
+/*
+ * @file     SimilarityMatrix.h
+ * @brief    All-vs-all structure similarity matrix.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing class SimilarityMatrix.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#ifndef SIMILARITY_MATRIX_H
+#define SIMILARITY_MATRIX_H
+
+#include <string>
+#include <vector>
+#include <biopp/biopp.h>
+#include "fideo/RnaBackendsTypes.h"
+#include "fideo/FideoHelper.h"
+
+namespace fideo
+{
+
+/** @brief Compares every pair of a set of structures
+ *
+ * The result is the upper triangle of the similarity matrix, without
+ * the diagonal, stored by rows: for i < j, compare(i, j) is at
+ * index(i, j, n). Since comparators are symmetric, the lower triangle
+ * is not computed.
+ *
+ * The triangle is split in square tiles of structures which a pool
+ * of workers takes in turns, so each worker keeps reusing the same
+ * few structures while they are in cache. Every worker has its own
+ * comparator, so any registered IStructureCmp whose instances can
+ * compare concurrently can be used; all the bundled ones can, the
+ * ones running tools use temporary files of their own.
+ */
+class SimilarityMatrix
+{
+public:
+    /** @brief Constructor of class
+     *
+     * @param comparator: name of the IStructureCmp backend to use
+     * @param workers: amount of threads comparing
+     * @param tileSize: amount of structures of each side of a tile
+     */
+    SimilarityMatrix(const std::string& comparator, const size_t workers, const size_t tileSize = DEFAULT_TILE_SIZE);
+
+    /** @brief Compare all the pairs into memory
+     *
+     * @param structures: the structures to compare
+     * @param upper: filled with entries(structures.size()) similitudes
+     * @return void
+     */
+    void compute(const std::vector<biopp::SecStructure>& structures, std::vector<Similitude>& upper) const;
+
+    /** @brief Compare all the pairs into a file
+     *
+     * The file is mapped in memory and the workers write the results
+     * in place, so the matrix never needs to fit in the heap. It holds
+     * just the similitudes, in the layout of the in-memory version.
+     * @param structures: the structures to compare
+     * @param path: file to create or overwrite
+     * @return void
+     */
+    void compute(const std::vector<biopp::SecStructure>& structures, const FilePath& path) const;
+
+    /** @brief Amount of entries of the upper triangle
+     *
+     * @param n: amount of structures
+     */
+    static size_t entries(const size_t n)
+    {
+        return n * (n - (n > 0 ? 1 : 0)) / 2;
+    }
+
+    /** @brief Position of a pair in the upper triangle
+     *
+     * @param i: index of a structure
+     * @param j: index of another structure, greater than i
+     * @param n: amount of structures
+     */
+    static size_t index(const size_t i, const size_t j, const size_t n)
+    {
+        return i * (2 * n - i - 1) / 2 + (j - i - 1);
+    }
+
+    static const size_t DEFAULT_TILE_SIZE = 64;
+
+private:
+    class Tiles;
+
+    void fill(const std::vector<biopp::SecStructure>& structures, Similitude* upper) const;
+
+    const std::string comparator;
+    const size_t workers;
+    const size_t tileSize;
+};
+
+} //namespace fideo
+
+#endif  /* SIMILARITY_MATRIX_H */
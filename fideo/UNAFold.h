@@ -37,6 +37,7 @@
 #endif
 
 #include <unistd.h>
+#include <cstdlib>
 #include <map>
 #include <etilico/etilico.h>
 #include "fideo/IFoldIntermediate.h"
@@ -59,6 +60,10 @@ private:
     virtual void deleteAllFilesAfterProcessing(const InputFile& inFile, const OutputFile& outFile);
     virtual void deleteObsoleteFiles(const InputFile& inFile);
     virtual void renameNecessaryFiles(const std::string& fileToRename, const std::string& newNameFile);
+    virtual void prepareEnergyData(const biopp::NucSequence& sequence, const bool isCirc, etilico::Command& command, InputFile& inputFile, OutputFile& outputFile, const Temperature temp = 37);
+    virtual void processingEnergy(const OutputFile& outputFile, Fe& freeEnergy);
+    virtual void deleteFilesAfterEnergy(const InputFile& inFile, const OutputFile& outFile);
+    virtual void processingRawResult(const InputFile& inputFile, PackedStructure& structure, Fe& freeEnergy);
 
     /** @brief Destructor of class
      *
@@ -162,23 +167,13 @@ private:
     const static std::string _det;
 };
 
-/** @brief constant that represents motif name
+/** @brief constant that represents the lines of a helix
  *
+ * The motif names are in IMotifObserver.h.
  */
 static const std::string HELIX         = "Helix";
-static const std::string EXTERNAL_LOOP = "External loop";
-static const std::string INTERIOR_LOOP = "Interior loop";
-static const std::string HAIRPIN_LOOP  = "Hairpin loop";
-static const std::string MULTI_LOOP    = "Multi-loop";
-static const std::string BULGE_LOOP    = "Bulge loop";
 static const std::string STACK         = "Stack";
 
-/** @brief constant that represents specific interior loop
- *
- */
-static const std::string ASYMMETRIC = "Interior Asymmetric";
-static const std::string SYMMETRIC = "Interior Symmetric";
-
 #define DET_FILE_PARSER_H
 #include "fideo/DetFileParser.h"
 #undef DET_FILE_PARSER_H
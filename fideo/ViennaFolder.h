@@ -0,0 +1,107 @@
+/*
+ * @file     ViennaFolder.h
+ * @brief    In-process folding with the ViennaRNA library.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Header file for fideo providing class ViennaFolder.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef _VIENNA_FOLDER_H
+#define _VIENNA_FOLDER_H
+
+#include <string>
+#include <vector>
+#include <biopp/biopp.h>
+#include "fideo/RnaBackendsTypes.h"
+
+namespace fideo
+{
+
+/**
+ * @brief Minimum free energy folding running inside the process.
+ *
+ * Uses the thread safe fold of the ViennaRNA 2.0 library: each
+ * instance owns its energy parameters and the library, built with
+ * OpenMP, keeps its dynamic programming arrays per thread. So a folder must be
+ * created, used and destroyed by one thread, and each thread
+ * needs its own folder.
+ */
+class ViennaFolder
+{
+public:
+    /**
+     * @brief Constructor of class
+     *
+     * @param temp temperature to fold.
+     */
+    explicit ViennaFolder(const Temperature temp = 37);
+
+    /**
+     * @brief Destructor of class
+     *
+     * Releases the parameters and the arrays of the calling thread.
+     */
+    ~ViennaFolder();
+
+    /**
+     * @brief Fold a sequence
+     *
+     * Built with OpenMP, the library sets up each fold from scratch: it
+     * reallocates its arrays and copies the parameters, whatever they
+     * are. That is some 15 microseconds, nothing for a hundred bases but
+     * a fair part of the fold of a few tens. Passing no parameters does
+     * not avoid it, and would fold at the library's global temperature.
+     * @param seq the sequence, in any case; T is read as U; not empty.
+     * @param isCircRNA if the sequence is circular.
+     * @param structure to write the structure found, in dot-bracket notation.
+     * @return the free energy of the structure.
+     */
+    Fe fold(const std::string& seq, const bool isCircRNA, std::string& structure);
+
+    /**
+     * @brief Base pair distance from the structure of a sequence to a target
+     *
+     * @param seq the sequence, in any case; T is read as U.
+     * @param target the wanted structure, of the same size.
+     * @return the amount of pairs in only one of the structures.
+     */
+    Similitude distance(const std::string& seq, const biopp::SecStructure& target);
+
+private:
+    ViennaFolder(const ViennaFolder&);
+    ViennaFolder& operator=(const ViennaFolder&);
+
+    void* parameters;   ///< paramT of the library, kept opaque to not leak its headers.
+    std::vector<char> input;
+    std::vector<char> buffer;
+};
+
+} //namespace fideo
+
+#endif  /* _VIENNA_FOLDER_H */
@@ -0,0 +1,305 @@
+/*
+ * @file     AdaptiveWalkInverse.cpp
+ * @brief    In-process inverse folding backend.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Implementation of class AdaptiveWalkInverse.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cctype>
+#include <biopp/biopp.h>
+#include "fideo/ViennaFolder.h"
+#include "fideo/RNAStartInverse.h"
+
+namespace fideo
+{
+
+/**
+ * Inverse folding by adaptive walk, run inside the process.
+ *
+ * Each run starts from the start sequence with its free (not lowercase)
+ * positions set at random, keeping the pairs of the target complementary,
+ * and mutates the positions whose pairing differs from the target while
+ * that lowers the base pair distance between the folded structure and
+ * the target. Candidates are folded with ViennaFolder, so concurrent
+ * runs (see InverseFoldParams::pa) fold in parallel threads.
+ */
+class AdaptiveWalkInverse : public RNAStartInverse
+{
+    typedef std::vector<long> PairTable;
+    static const long UNPAIRED;
+
+    /**
+     * Positions changed together: a single position, or both
+     * positions of a target pair when the two are free.
+     */
+    struct Site
+    {
+        size_t first;
+        long second;
+    };
+    typedef std::vector<Site> Sites;
+    typedef std::vector<std::string> Options;
+
+    PairTable target;
+
+    static void toPairTable(const std::string& structure, PairTable& table);
+    static bool canPair(const char a, const char b);
+
+    void options(const Site& site, const std::string& design, Options& result) const;
+    void apply(const Site& site, const std::string& option, std::string& design) const;
+    Similitude distance(ViennaFolder& folder, const std::string& design, std::vector<bool>& mismatch) const;
+    bool walk(RunControl& control, const Sites& sites, ViennaFolder& folder, std::mt19937& random, Candidate& candidate) const;
+
+    virtual void generate(RunControl&, Candidates&, const Temperature) const;
+    virtual void query_start(IStartProvider*);
+
+public:
+    AdaptiveWalkInverse(const InverseFoldParams& params);
+};
+
+const long AdaptiveWalkInverse::UNPAIRED = -1;
+
+REGISTER_FACTORIZABLE_CLASS_WITH_ARG(IFoldInverse, AdaptiveWalkInverse, std::string, "AdaptiveWalk", const InverseFoldParams&);
+
+AdaptiveWalkInverse::AdaptiveWalkInverse(const InverseFoldParams& params) :
+    RNAStartInverse(params),
+    target(params.structure.size(), UNPAIRED)
+{
+    for (size_t i = 0; i < structure.size(); ++i)
+    {
+        if (structure.is_paired(i))
+            target[i] = long(structure.paired_with(i));
+    }
+}
+
+void AdaptiveWalkInverse::query_start(IStartProvider* provider)
+{
+    provider->get_partial_start(this);
+    if (start.size() != structure.size())
+        throw RNABackendException("Partial start and target structure must have the same length");
+}
+
+void AdaptiveWalkInverse::toPairTable(const std::string& structure, PairTable& table)
+{
+    table.assign(structure.size(), UNPAIRED);
+    std::vector<size_t> opened;
+    for (size_t i = 0; i < structure.size(); ++i)
+    {
+        if (structure[i] == '(')
+        {
+            opened.push_back(i);
+        }
+        else if (structure[i] == ')')
+        {
+            if (opened.empty())
+                throw RNABackendException("Unbalanced structure folded");
+            table[i] = long(opened.back());
+            table[opened.back()] = long(i);
+            opened.pop_back();
+        }
+    }
+}
+
+bool AdaptiveWalkInverse::canPair(const char a, const char b)
+{
+    switch (a)
+    {
+        case 'A':
+            return b == 'U';
+        case 'C':
+            return b == 'G';
+        case 'G':
+            return b == 'C' || b == 'U';
+        case 'U':
+            return b == 'A' || b == 'G';
+        default:
+            return false;
+    }
+}
+
+void AdaptiveWalkInverse::options(const Site& site, const std::string& design, Options& result) const
+{
+    static const char* const BASES[] = { "A", "C", "G", "U" };
+    static const char* const PAIRS[] = { "GC", "CG", "AU", "UA", "GU", "UG" };
+
+    result.clear();
+    if (site.second != UNPAIRED)
+    {
+        result.assign(PAIRS, PAIRS + 6);
+    }
+    else
+    {
+        //a free position paired with a fixed one keeps the pair when possible.
+        const long partner = target[site.first];
+        for (size_t i = 0; i < 4; ++i)
+        {
+            if (partner == UNPAIRED || canPair(BASES[i][0], design[partner]))
+                result.push_back(BASES[i]);
+        }
+        if (result.empty())
+            result.assign(BASES, BASES + 4);
+    }
+}
+
+void AdaptiveWalkInverse::apply(const Site& site, const std::string& option, std::string& design) const
+{
+    design[site.first] = option[0];
+    if (site.second != UNPAIRED)
+        design[site.second] = option[1];
+}
+
+Similitude AdaptiveWalkInverse::distance(ViennaFolder& folder, const std::string& design, std::vector<bool>& mismatch) const
+{
+    std::string folded;
+    PairTable table;
+    folder.fold(design, structure.is_circular(), folded);
+    toPairTable(folded, table);
+
+    //base pair distance: pairs of one structure missing in the other.
+    Similitude result = 0;
+    for (size_t i = 0; i < table.size(); ++i)
+    {
+        mismatch[i] = table[i] != target[i];
+        if (mismatch[i])
+        {
+            if (table[i] > long(i))
+                ++result;
+            if (target[i] > long(i))
+                ++result;
+        }
+    }
+    return result;
+}
+
+bool AdaptiveWalkInverse::walk(RunControl& control, const Sites& sites, ViennaFolder& folder, std::mt19937& random, Candidate& candidate) const
+{
+    std::string design(start.size(), 'A');
+    for (size_t i = 0; i < start.size(); ++i)
+    {
+        const char base = char(toupper(start[i]));
+        design[i] = (base == 'T') ? 'U' : base;
+    }
+    Options choices;
+    for (Sites::const_iterator it = sites.begin(); it != sites.end(); ++it)
+    {
+        options(*it, design, choices);
+        apply(*it, choices[std::uniform_int_distribution<size_t>(0, choices.size() - 1)(random)], design);
+    }
+    const std::string initial = design;
+
+    std::vector<bool> mismatch(design.size());
+    Similitude cost = distance(folder, design, mismatch);
+    Sites order(sites);
+    bool improved = true;
+    while (cost > 0 && improved)
+    {
+        improved = false;
+        std::shuffle(order.begin(), order.end(), random);
+        for (Sites::const_iterator it = order.begin(); it != order.end() && !improved; ++it)
+        {
+            if (!mismatch[it->first] && (it->second == UNPAIRED || !mismatch[it->second]))
+                continue;
+            const std::string previous = design;
+            options(*it, design, choices);
+            std::shuffle(choices.begin(), choices.end(), random);
+            for (Options::const_iterator option = choices.begin(); option != choices.end() && !improved; ++option)
+            {
+                if (control.cancelled())
+                    return false;
+                apply(*it, *option, design);
+                std::vector<bool> changed(design.size());
+                const Similitude trial = (design == previous) ? cost : distance(folder, design, changed);
+                if (trial < cost)
+                {
+                    cost = trial;
+                    mismatch.swap(changed);
+                    improved = true;
+                }
+                else
+                {
+                    design = previous;
+                }
+            }
+        }
+    }
+
+    candidate.seq.resize(design.size());
+    candidate.hd = 0;
+    for (size_t i = 0; i < design.size(); ++i)
+    {
+        candidate.seq[i] = char(tolower(design[i]));
+        if (design[i] != initial[i])
+            ++candidate.hd;
+    }
+    candidate.sd = cost;
+    return true;
+}
+
+void AdaptiveWalkInverse::generate(RunControl& control, Candidates& found, const Temperature temp) const
+{
+    if (start.size() != target.size())
+        throw RNABackendException("Partial start and target structure must have the same length");
+
+    //free positions are the ones set to the wildcard by the base class.
+    Sites sites;
+    for (size_t i = 0; i < start.size(); ++i)
+    {
+        if (islower(start[i]))
+            continue;
+        const long partner = target[i];
+        if (partner == UNPAIRED || islower(start[partner]))
+        {
+            const Site site = { i, UNPAIRED };
+            sites.push_back(site);
+        }
+        else if (partner > long(i))
+        {
+            const Site site = { i, partner };
+            sites.push_back(site);
+        }
+    }
+
+    std::random_device seed;
+    std::mt19937 random(seed());
+    ViennaFolder folder(temp);
+    for (size_t i = 0; i < designs_per_run; ++i)
+    {
+        Candidate candidate;
+        if (!walk(control, sites, folder, random, candidate))
+            return;
+        found.push_back(candidate);
+    }
+}
+
+} //end namespace fideo
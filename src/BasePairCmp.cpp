@@ -0,0 +1,81 @@
+/*
+ * @file     BasePairCmp.cpp
+ * @brief    Structure comparison by base pairs.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Implementation of classes BasePairDistance and BasePairOverlap.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "fideo/IStructureCmp.h"
+#include "fideo/BasePairSet.h"
+
+namespace fideo
+{
+
+/**
+ * Base pair distance: the amount of pairs in only one of the structures,
+ * so 0 means equal structures. The pair sets are buffers kept between
+ * calls, so an instance must not be shared between threads.
+ */
+class BasePairDistance : public IStructureCmp
+{
+    mutable BasePairSet pairs1;
+    mutable BasePairSet pairs2;
+
+    virtual Similitude compare(const biopp::SecStructure& struct1, const biopp::SecStructure& struct2) const
+    {
+        pairs1.assign(struct1);
+        pairs2.assign(struct2);
+        return Similitude(pairs1.distance(pairs2));
+    }
+};
+
+REGISTER_FACTORIZABLE_CLASS(IStructureCmp, BasePairDistance, std::string, "BasePairDistance");
+
+/**
+ * Pair overlap: twice the common pairs over the total pairs, from 0 for
+ * no common pairs to 1 for equal structures. Same buffers as
+ * BasePairDistance.
+ */
+class BasePairOverlap : public IStructureCmp
+{
+    mutable BasePairSet pairs1;
+    mutable BasePairSet pairs2;
+
+    virtual Similitude compare(const biopp::SecStructure& struct1, const biopp::SecStructure& struct2) const
+    {
+        pairs1.assign(struct1);
+        pairs2.assign(struct2);
+        return Similitude(pairs1.overlap(pairs2));
+    }
+};
+
+REGISTER_FACTORIZABLE_CLASS(IStructureCmp, BasePairOverlap, std::string, "BasePairOverlap");
+
+} //end namespace fideo
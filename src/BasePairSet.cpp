@@ -0,0 +1,160 @@
+/*
+ * @file     BasePairSet.cpp
+ * @brief    Provides the base pair set of a structure for fast comparisons.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Implementation of class BasePairSet.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#include <algorithm>
+#include "fideo/BasePairSet.h"
+#include "fideo/FideoHelper.h"
+
+namespace fideo
+{
+
+BasePairSet::BasePairSet()
+    : _pairs(0)
+{}
+
+BasePairSet::BasePairSet(const biopp::SecStructure& structure)
+    : _pairs(0)
+{
+    assign(structure);
+}
+
+void BasePairSet::assign(const biopp::SecStructure& structure)
+{
+    const size_t positions = structure.size();
+    _partners.resize(positions);
+    _paired.assign((positions + POSITIONS_PER_WORD - 1) / POSITIONS_PER_WORD, 0);
+    _pairs = 0;
+    for (biopp::SeqIndex i = 0; i < positions; ++i)
+    {
+        if (structure.is_paired(i))
+        {
+            const biopp::SeqIndex partner = structure.paired_with(i);
+            _partners[i] = uint32_t(partner);
+            _paired[i / POSITIONS_PER_WORD] |= uint64_t(1) << (i % POSITIONS_PER_WORD);
+            if (i < partner)
+                ++_pairs;
+        }
+        else
+        {
+            _partners[i] = uint32_t(i);
+        }
+    }
+}
+
+size_t BasePairSet::common(const BasePairSet& other) const
+{
+    const uint32_t* const a = _partners.data();
+    const uint32_t* const b = other._partners.data();
+    const size_t positions = std::min(size(), other.size());
+    size_t count = 0;
+    //the same opening position with the same partner; no branches, so
+    //the compiler can vectorize it.
+    for (uint32_t i = 0; i < positions; ++i)
+    {
+        count += size_t((a[i] == b[i]) & (a[i] > i));
+    }
+    return count;
+}
+
+/** @brief Bits set in a word, by branch free arithmetic
+ *
+ */
+static size_t popcountArithmetic(uint64_t word)
+{
+    word = word - ((word >> 1) & 0x5555555555555555ULL);
+    word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return size_t((word * 0x0101010101010101ULL) >> 56);
+}
+
+/** @brief Bits that differ between two bitsets, using the popcount instruction
+ *
+ * The missing words of the shorter bitset are taken as 0.
+ */
+FIDEO_TARGET_POPCNT
+static size_t differingPopcount(const uint64_t* shorter, const size_t shorterSize, const uint64_t* longer, const size_t longerSize)
+{
+    size_t differing = 0;
+    for (size_t i = 0; i < shorterSize; ++i)
+    {
+        differing += size_t(__builtin_popcountll(shorter[i] ^ longer[i]));
+    }
+    for (size_t i = shorterSize; i < longerSize; ++i)
+    {
+        differing += size_t(__builtin_popcountll(longer[i]));
+    }
+    return differing;
+}
+
+/** @brief Bits that differ between two bitsets, by branch free arithmetic
+ *
+ */
+static size_t differingArithmetic(const uint64_t* shorter, const size_t shorterSize, const uint64_t* longer, const size_t longerSize)
+{
+    size_t differing = 0;
+    for (size_t i = 0; i < shorterSize; ++i)
+    {
+        differing += popcountArithmetic(shorter[i] ^ longer[i]);
+    }
+    for (size_t i = shorterSize; i < longerSize; ++i)
+    {
+        differing += popcountArithmetic(longer[i]);
+    }
+    return differing;
+}
+
+size_t BasePairSet::lowerBound(const BasePairSet& other) const
+{
+    static const bool hardware = helper::hasPopcount();
+    const Words& shorter = _paired.size() < other._paired.size() ? _paired : other._paired;
+    const Words& longer = _paired.size() < other._paired.size() ? other._paired : _paired;
+    if (longer.empty())
+    {
+        return 0;
+    }
+    const uint64_t* const shorterWords = shorter.empty() ? NULL : &shorter[0];
+    const size_t differing = hardware
+                             ? differingPopcount(shorterWords, shorter.size(), &longer[0], longer.size())
+                             : differingArithmetic(shorterWords, shorter.size(), &longer[0], longer.size());
+    return (differing + 1) / 2;
+}
+
+double BasePairSet::overlap(const BasePairSet& other) const
+{
+    const size_t total = _pairs + other._pairs;
+    return total == 0 ? 1.0 : 2.0 * double(common(other)) / double(total);
+}
+
+} //namespace fideo
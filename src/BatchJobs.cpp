@@ -0,0 +1,154 @@
+/*
+ * @file     BatchJobs.cpp
+ * @brief    Provides batch fold and hybridize jobs that run each distinct key once.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Source file for fideo providing batch services with deduplication.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <unordered_map>
+#include "fideo/BatchJobs.h"
+#include "fideo/FideoHelper.h"
+
+namespace fideo
+{
+
+/** @brief Exact key of a job: the sequences bytes plus the scalar parameters
+ *
+ * The hash is computed once over the bytes; equality still compares them, so
+ * a hash collision never merges different jobs.
+ */
+struct JobKey
+{
+    std::string bytes;
+    uint64_t hash;
+
+    bool operator==(const JobKey& other) const
+    {
+        return hash == other.hash && bytes == other.bytes;
+    }
+};
+
+struct JobKeyHash
+{
+    size_t operator()(const JobKey& key) const
+    {
+        return size_t(key.hash);
+    }
+};
+
+typedef std::unordered_map<JobKey, size_t, JobKeyHash> DistinctJobs;
+
+static const char SEPARATOR = '\0';
+
+template <class T>
+static void appendScalar(std::string& bytes, const T value)
+{
+    bytes.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+static void makeKey(const FoldJob& job, JobKey& key)
+{
+    key.bytes = job.sequence.getString();
+    key.bytes += SEPARATOR;
+    appendScalar(key.bytes, job.circular);
+    appendScalar(key.bytes, job.temp);
+    key.hash = helper::hash64(key.bytes.data(), key.bytes.size());
+}
+
+static void makeKey(const HybridizeJob& job, JobKey& key)
+{
+    key.bytes = job.longerSeq.getString();
+    key.bytes += SEPARATOR;
+    key.bytes += job.shorterSeq.getString();
+    key.bytes += SEPARATOR;
+    appendScalar(key.bytes, job.longerCirc);
+    appendScalar(key.bytes, job.temp);
+    key.hash = helper::hash64(key.bytes.data(), key.bytes.size());
+}
+
+/** @brief Map every job to the index of its first occurrence
+ *
+ * @param jobs: the batch
+ * @param firstOccurrence: to fill with, for each job, the index of the job that will run
+ * @param report: to fill with the amount of duplicates
+ */
+template <class Job>
+static void findDuplicates(const std::vector<Job>& jobs, std::vector<size_t>& firstOccurrence, DedupReport& report)
+{
+    DistinctJobs distinct;
+    distinct.reserve(jobs.size());
+    firstOccurrence.resize(jobs.size());
+    JobKey key;
+    for (size_t i = 0; i < jobs.size(); ++i)
+    {
+        makeKey(jobs[i], key);
+        firstOccurrence[i] = distinct.insert(std::make_pair(key, i)).first->second;
+    }
+    report.total = jobs.size();
+    report.distinct = distinct.size();
+}
+
+void foldBatch(IFold& folder, const std::vector<FoldJob>& jobs, std::vector<FoldResult>& results, DedupReport& report)
+{
+    std::vector<size_t> firstOccurrence;
+    findDuplicates(jobs, firstOccurrence, report);
+    results.resize(jobs.size());
+    for (size_t i = 0; i < jobs.size(); ++i)
+    {
+        if (firstOccurrence[i] == i)
+        {
+            folder.foldLazy(jobs[i].sequence, jobs[i].circular, results[i], jobs[i].temp);
+        }
+        else
+        {
+            results[i] = results[firstOccurrence[i]];
+        }
+    }
+}
+
+void hybridizeBatch(const IHybridize& hybridizer, const std::vector<HybridizeJob>& jobs, std::vector<Fe>& results, DedupReport& report)
+{
+    std::vector<size_t> firstOccurrence;
+    findDuplicates(jobs, firstOccurrence, report);
+    results.resize(jobs.size());
+    for (size_t i = 0; i < jobs.size(); ++i)
+    {
+        if (firstOccurrence[i] == i)
+        {
+            results[i] = hybridizer.hybridize(jobs[i].longerSeq, jobs[i].longerCirc, jobs[i].shorterSeq, jobs[i].temp);
+        }
+        else
+        {
+            results[i] = results[firstOccurrence[i]];
+        }
+    }
+}
+
+} //namespace fideo
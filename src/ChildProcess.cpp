@@ -0,0 +1,217 @@
+/*
+ * @file     ChildProcess.cpp
+ * @brief    This is the implementation of ChildProcess class.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Source file for fideo providing class ChildProcess implementation.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "fideo/ChildProcess.h"
+
+namespace fideo
+{
+
+static const size_t READ_BLOCK = 4096;
+
+ChildProcess::ChildProcess()
+    : _pid(0),
+      _output(-1),
+      _pending(),
+      _pendingFrom(0),
+      _eof(false),
+      _lock()
+{}
+
+ChildProcess::~ChildProcess()
+{
+    if (running())
+    {
+        kill();
+        wait();
+    }
+    closeOutput();
+}
+
+void ChildProcess::start(const etilico::Command& command, const bool captureOutput)
+{
+    if (running())
+    {
+        throw StateException("Child process already started");
+    }
+    int fds[2] = { -1, -1 };
+    //close-on-exec, so children started meanwhile by other threads do not keep the pipe open.
+    if (captureOutput && pipe2(fds, O_CLOEXEC) != 0)
+    {
+        throw RNABackendException("Could not create pipe to " + command);
+    }
+    const pid_t pid = fork();
+    if (pid < 0)
+    {
+        if (captureOutput)
+        {
+            close(fds[0]);
+            close(fds[1]);
+        }
+        throw RNABackendException("Could not start " + command);
+    }
+    if (pid == 0)
+    {
+        //child: only async-signal-safe calls from here.
+        setpgid(0, 0);
+        if (captureOutput)
+        {
+            dup2(fds[1], STDOUT_FILENO);
+            close(fds[0]);
+            close(fds[1]);
+        }
+        execl("/bin/sh", "sh", "-c", command.c_str(), static_cast<char*>(NULL));
+        _exit(127);
+    }
+    //also set from the parent, so kill() never races with the child's setpgid.
+    setpgid(pid, pid);
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _pid = pid;
+    }
+    _pending.clear();
+    _pendingFrom = 0;
+    _eof = !captureOutput;
+    if (captureOutput)
+    {
+        close(fds[1]);
+        _output = fds[0];
+    }
+}
+
+size_t ChildProcess::read(char* buffer, const size_t size)
+{
+    size_t done = 0;
+    if (_pendingFrom < _pending.size())
+    {
+        done = std::min(size, _pending.size() - _pendingFrom);
+        _pending.copy(buffer, done, _pendingFrom);
+        _pendingFrom += done;
+    }
+    while (done == 0 && !_eof)
+    {
+        const ssize_t n = ::read(_output, buffer, size);
+        if (n > 0)
+        {
+            done = n;
+        }
+        else if (n == 0 || errno != EINTR)
+        {
+            _eof = true;
+        }
+    }
+    return done;
+}
+
+bool ChildProcess::readLine(std::string& line)
+{
+    size_t end = _pending.find('\n', _pendingFrom);
+    while (end == std::string::npos && !_eof)
+    {
+        _pending.erase(0, _pendingFrom);
+        _pendingFrom = 0;
+        char block[READ_BLOCK];
+        const ssize_t n = ::read(_output, block, READ_BLOCK);
+        if (n > 0)
+        {
+            const size_t from = _pending.size();
+            _pending.append(block, n);
+            end = _pending.find('\n', from);
+        }
+        else if (n == 0 || errno != EINTR)
+        {
+            _eof = true;
+        }
+    }
+    const bool ret = end != std::string::npos || _pendingFrom < _pending.size();
+    if (end == std::string::npos)
+    {
+        end = _pending.size();
+    }
+    line.assign(_pending, _pendingFrom, end - _pendingFrom);
+    _pendingFrom = std::min(end + 1, _pending.size());
+    return ret;
+}
+
+int ChildProcess::wait()
+{
+    if (!running())
+    {
+        throw StateException("Child process not started");
+    }
+    closeOutput();
+    const pid_t pid = _pid;
+    //Wait without reaping, so a concurrent kill() never targets a recycled pid.
+    siginfo_t info;
+    while (waitid(P_PID, pid, &info, WEXITED | WNOWAIT) != 0 && errno == EINTR)
+    {}
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _pid = 0;
+    }
+    int status;
+    pid_t ret;
+    do
+    {
+        ret = waitpid(pid, &status, 0);
+    }
+    while (ret < 0 && errno == EINTR);
+    return (ret > 0 && WIFEXITED(status)) ? WEXITSTATUS(status) : -1;
+}
+
+void ChildProcess::kill()
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_pid > 0)
+    {
+        ::kill(-_pid, SIGKILL);
+    }
+}
+
+void ChildProcess::closeOutput()
+{
+    if (_output >= 0)
+    {
+        close(_output);
+        _output = -1;
+    }
+    _eof = true;
+}
+
+} //namespace fideo
@@ -0,0 +1,163 @@
+/*
+ * @file     DesignScheduler.cpp
+ * @brief    Scheduler of inverse folding jobs.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Implementation of class DesignScheduler.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <memory>
+#include "fideo/DesignScheduler.h"
+#include "fideo/RnaBackendsException.h"
+
+namespace fideo
+{
+
+/**
+ * Queues of the workers and the sink of one run.
+ * Owners take from the front of their queue and thieves
+ * from the back, so they rarely contend for the same job.
+ */
+class DesignScheduler::Batch
+{
+public:
+    Batch(const std::string& backend, const std::vector<DesignJob>& jobs, IDesignSink& sink, const size_t workers)
+        : backend(backend), jobs(jobs), sink(sink), queues(workers), locks(workers)
+    {
+        for (size_t i = 0; i < workers; ++i)
+        {
+            locks[i].reset(new std::mutex);
+        }
+        for (size_t i = 0; i < jobs.size(); ++i)
+        {
+            queues[i % workers].push_back(i);
+        }
+    }
+
+    void work(const size_t worker)
+    {
+        size_t job;
+        while (take(worker, job))
+        {
+            design(job);
+        }
+    }
+
+private:
+    bool take(const size_t worker, size_t& job)
+    {
+        {
+            std::lock_guard<std::mutex> guard(*locks[worker]);
+            if (!queues[worker].empty())
+            {
+                job = queues[worker].front();
+                queues[worker].pop_front();
+                return true;
+            }
+        }
+        //jobs are never added, so once every queue is seen empty the work is over.
+        for (size_t i = 1; i < queues.size(); ++i)
+        {
+            const size_t victim = (worker + i) % queues.size();
+            std::lock_guard<std::mutex> guard(*locks[victim]);
+            if (!queues[victim].empty())
+            {
+                job = queues[victim].back();
+                queues[victim].pop_back();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void design(const size_t job)
+    {
+        const DesignJob& current = jobs[job];
+        size_t designs = 0;
+        DesignJobStatus status = JobCompleted;
+        try
+        {
+            std::unique_ptr<IFoldInverse> inverse(IFoldInverse::factory(backend, current.params));
+            mili::assert_throw<InvalidDerived>(inverse.get() != NULL);
+            inverse->set_budget(current.budget);
+            inverse->set_start(current.start);
+            while (designs < current.count)
+            {
+                biopp::NucSequence seq;
+                inverse->fold_inverse(seq, current.temp);
+                ++designs;
+                std::lock_guard<std::mutex> guard(sinkLock);
+                sink.designed(job, seq);
+            }
+        }
+        catch (const DesignBudgetExhausted&)
+        {
+            status = JobBudgetExhausted;
+        }
+        catch (...)
+        {
+            //nothing may escape the worker, it would terminate the whole batch.
+            status = JobFailed;
+        }
+        std::lock_guard<std::mutex> guard(sinkLock);
+        sink.finished(job, status, designs);
+    }
+
+    const std::string& backend;
+    const std::vector<DesignJob>& jobs;
+    IDesignSink& sink;
+    std::mutex sinkLock;
+    std::vector<std::deque<size_t> > queues;
+    std::vector<std::unique_ptr<std::mutex> > locks;
+};
+
+DesignScheduler::DesignScheduler(const std::string& backend, const size_t workers)
+    : backend(backend), workers(workers)
+{
+    mili::assert_throw<RNABackendException>(workers > 0);
+}
+
+void DesignScheduler::run(const std::vector<DesignJob>& jobs, IDesignSink& sink) const
+{
+    Batch batch(backend, jobs, sink, workers);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < workers; ++i)
+    {
+        threads.push_back(std::thread(&Batch::work, &batch, i));
+    }
+    for (size_t i = 0; i < threads.size(); ++i)
+    {
+        threads[i].join();
+    }
+}
+
+} //namespace fideo
@@ -0,0 +1,144 @@
+/*
+ * @file     DiversityFilter.cpp
+ * @brief    Rejection of near-duplicate designs.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Implementation of class DiversityFilter.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <algorithm>
+#include "fideo/DiversityFilter.h"
+#include "fideo/FideoHelper.h"
+
+namespace fideo
+{
+
+DiversityFilter::DiversityFilter(const Distance distance)
+    : _distance(distance),
+      _bases(0),
+      _stride(0),
+      _designs(0),
+      _words()
+{}
+
+/** @brief Designs checked before looking for a near one
+ *
+ */
+static const size_t BLOCK = 16;
+
+/** @brief Whether any design is within a distance of a candidate
+ *
+ * The distances of a block of designs are all computed before checking
+ * them, so the loops over the designs and their words have no exit.
+ */
+FIDEO_TARGET_POPCNT
+static bool anyNearPopcount(const uint64_t* candidate, const uint64_t* design, const size_t designs, const size_t stride, const size_t distance)
+{
+    size_t i = 0;
+    while (i < designs)
+    {
+        const size_t end = std::min(designs, i + BLOCK);
+        bool near = false;
+        for (; i < end; ++i, design += stride)
+        {
+            size_t differing = 0;
+            for (size_t w = 0; w < stride; ++w)
+            {
+                differing += size_t(__builtin_popcountll(PackedSequence::differingBases(candidate[w], design[w])));
+            }
+            near |= differing <= distance;
+        }
+        if (near)
+            return true;
+    }
+    return false;
+}
+
+/** @brief anyNearPopcount, for processors without popcount
+ *
+ */
+static bool anyNearArithmetic(const uint64_t* candidate, const uint64_t* design, const size_t designs, const size_t stride, const size_t distance)
+{
+    size_t i = 0;
+    while (i < designs)
+    {
+        const size_t end = std::min(designs, i + BLOCK);
+        bool near = false;
+        for (; i < end; ++i, design += stride)
+        {
+            size_t differing = 0;
+            for (size_t w = 0; w < stride; ++w)
+            {
+                differing += PackedSequence::differingBasesArithmetic(candidate[w], design[w]);
+            }
+            near |= differing <= distance;
+        }
+        if (near)
+            return true;
+    }
+    return false;
+}
+
+bool DiversityFilter::admits(const PackedSequence& candidate) const
+{
+    if (!enabled() || _designs == 0)
+        return true;
+    mili::assert_throw<IndexOutOfRange>(candidate.size() == _bases);
+
+    //Hamming distances are whole, so within the distance is within its floor.
+    const size_t distance = size_t(_distance);
+    const bool hardware = helper::hasPopcount();
+    const uint64_t* const words = candidate.words().data();
+    return hardware ? !anyNearPopcount(words, _words.data(), _designs, _stride, distance)
+                    : !anyNearArithmetic(words, _words.data(), _designs, _stride, distance);
+}
+
+void DiversityFilter::insert(const PackedSequence& design)
+{
+    if (!enabled())
+        return;
+    if (_designs == 0)
+    {
+        _bases = design.size();
+        _stride = design.words().size();
+    }
+    mili::assert_throw<IndexOutOfRange>(design.size() == _bases);
+    _words.insert(_words.end(), design.words().begin(), design.words().end());
+    ++_designs;
+}
+
+void DiversityFilter::clear()
+{
+    _words.clear();
+    _designs = 0;
+    _bases = 0;
+    _stride = 0;
+}
+
+} //namespace fideo
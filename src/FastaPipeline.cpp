@@ -0,0 +1,242 @@
+/*
+ * @file     FastaPipeline.cpp
+ * @brief    This is the implementation of the FASTA pipelines.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Source file for fideo providing foldFasta and hybridizeFasta implementation.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include "fideo/FastaPipeline.h"
+#include "fideo/BoundedQueue.h"
+#include "fideo/IFold.h"
+#include "fideo/IHybridize.h"
+
+namespace fideo
+{
+
+static const size_t DEFAULT_BATCH_SIZE = 64;
+static const size_t BATCHES_PER_WORKER = 2;
+
+static size_t defaultWorkers()
+{
+    const size_t cores = std::thread::hardware_concurrency();
+    return cores > 0 ? cores : 1;
+}
+
+FastaPipelineParams::FastaPipelineParams()
+    : workers(defaultWorkers()),
+      batchSize(DEFAULT_BATCH_SIZE),
+      queueCapacity(BATCHES_PER_WORKER * workers),
+      circular(false),
+      temp(37)
+{}
+
+typedef std::vector<FastaRecord> SequenceBatch;
+
+/** @brief State shared between the reader and the workers
+ *
+ */
+struct PipelineState
+{
+    PipelineState(const size_t capacity)
+        : queue(capacity)
+    {}
+
+    void fail()
+    {
+        std::lock_guard<std::mutex> guard(errorLock);
+        if (!error)
+        {
+            error = std::current_exception();
+        }
+        queue.close();
+    }
+
+    BoundedQueue<SequenceBatch> queue;
+    std::mutex observerLock;
+    std::mutex errorLock;
+    std::exception_ptr error;
+};
+
+/** @brief Folds the sequences of the batches with its own backend
+ *
+ */
+class FoldWorker
+{
+public:
+    FoldWorker(const std::string& backend, const FastaPipelineParams& params, IFoldResultObserver& observer)
+        : _folder(Fold::new_class(backend)),
+          _params(params),
+          _observer(observer)
+    {
+        mili::assert_throw<InvalidDerived>(_folder.get() != NULL);
+    }
+
+    void process(const FastaRecord& record, std::mutex& observerLock)
+    {
+        const biopp::NucSequence sequence(record.sequence);
+        biopp::SecStructure structure;
+        const Fe freeEnergy = _folder->fold(sequence, _params.circular, structure, _params.temp);
+        std::lock_guard<std::mutex> guard(observerLock);
+        _observer.processFold(record, freeEnergy, structure);
+    }
+
+private:
+    std::unique_ptr<IFold> _folder;
+    const FastaPipelineParams& _params;
+    IFoldResultObserver& _observer;
+};
+
+/** @brief Hybridizes the sequences of the batches with its own backend
+ *
+ */
+class HybridizeWorker
+{
+public:
+    HybridizeWorker(const std::string& backend, const biopp::NucSequence& shorterSeq, const FastaPipelineParams& params, IHybridizeResultObserver& observer)
+        : _hybridizer(Hybridize::new_class(backend)),
+          _shorterSeq(shorterSeq),
+          _params(params),
+          _observer(observer)
+    {
+        mili::assert_throw<InvalidDerived>(_hybridizer.get() != NULL);
+    }
+
+    void process(const FastaRecord& record, std::mutex& observerLock)
+    {
+        const biopp::NucSequence sequence(record.sequence);
+        const Fe freeEnergy = _hybridizer->hybridize(sequence, _params.circular, _shorterSeq, _params.temp);
+        std::lock_guard<std::mutex> guard(observerLock);
+        _observer.processHybridize(record, freeEnergy);
+    }
+
+private:
+    std::unique_ptr<IHybridize> _hybridizer;
+    const biopp::NucSequence& _shorterSeq;
+    const FastaPipelineParams& _params;
+    IHybridizeResultObserver& _observer;
+};
+
+/** @brief Consume batches until the queue is closed
+ *
+ * The worker is built inside the thread, so a failure creating the backend is
+ * reported like any other failure.
+ */
+template <class Worker, class Factory>
+static void consume(PipelineState& state, const Factory& factory)
+{
+    try
+    {
+        std::unique_ptr<Worker> worker(factory());
+        SequenceBatch batch;
+        while (state.queue.pop(batch))
+        {
+            for (size_t i = 0; i < batch.size(); ++i)
+            {
+                worker->process(batch[i], state.observerLock);
+            }
+        }
+    }
+    catch (...)
+    {
+        state.fail();
+    }
+}
+
+/** @brief Read the file in batches while the workers consume them
+ *
+ */
+template <class Worker, class Factory>
+static void runPipeline(const FilePath& file, const FastaPipelineParams& params, const Factory& factory)
+{
+    PipelineState state(params.queueCapacity);
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < std::max<size_t>(params.workers, 1); ++i)
+    {
+        workers.push_back(std::thread(consume<Worker, Factory>, std::ref(state), std::cref(factory)));
+    }
+    try
+    {
+        FastaReader reader(file);
+        const size_t batchSize = std::max<size_t>(params.batchSize, 1);
+        SequenceBatch batch;
+        FastaRecord record;
+        bool open = true;
+        while (open && reader.next(record))
+        {
+            batch.push_back(std::move(record));
+            if (batch.size() == batchSize)
+            {
+                open = state.queue.push(std::move(batch));
+                batch.clear();
+            }
+        }
+        if (open && !batch.empty())
+        {
+            state.queue.push(std::move(batch));
+        }
+        state.queue.close();
+    }
+    catch (...)
+    {
+        state.fail();
+    }
+    for (size_t i = 0; i < workers.size(); ++i)
+    {
+        workers[i].join();
+    }
+    if (state.error)
+    {
+        std::rethrow_exception(state.error);
+    }
+}
+
+void foldFasta(const FilePath& file, const std::string& backend, const FastaPipelineParams& params, IFoldResultObserver& observer)
+{
+    runPipeline<FoldWorker>(file, params, [&]()
+    {
+        return new FoldWorker(backend, params, observer);
+    });
+}
+
+void hybridizeFasta(const FilePath& file, const std::string& backend, const biopp::NucSequence& shorterSeq, const FastaPipelineParams& params, IHybridizeResultObserver& observer)
+{
+    runPipeline<HybridizeWorker>(file, params, [&]()
+    {
+        return new HybridizeWorker(backend, shorterSeq, params, observer);
+    });
+}
+
+} //namespace fideo
@@ -0,0 +1,208 @@
+/*
+ * @file     FastaReader.cpp
+ * @brief    This is the implementation of FastaReader class.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Source file for fideo providing class FastaReader implementation.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <cctype>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "fideo/FastaReader.h"
+
+namespace fideo
+{
+
+static const char HEADER_MARK = '>';
+static const char COMMENT_MARK = ';';
+static const unsigned char GZIP_MAGIC[2] = { 0x1f, 0x8b };
+
+/** @brief Quote a path to be used in a shell command
+ *
+ */
+static std::string shellQuote(const std::string& str)
+{
+    std::string quoted = "'";
+    for (size_t i = 0; i < str.size(); ++i)
+    {
+        if (str[i] == '\'')
+        {
+            quoted += "'\\''";
+        }
+        else
+        {
+            quoted += str[i];
+        }
+    }
+    return quoted + "'";
+}
+
+bool FastaReader::isCompressed(const FilePath& file)
+{
+    File in(file.c_str(), std::ios::binary);
+    mili::assert_throw<NotFoundFileException>(in);
+    unsigned char magic[2] = { 0, 0 };
+    in.read(reinterpret_cast<char*>(magic), sizeof(magic));
+    return in && memcmp(magic, GZIP_MAGIC, sizeof(magic)) == 0;
+}
+
+FastaReader::FastaReader(const FilePath& file)
+    : _file(file),
+      _compressed(isCompressed(file)),
+      _gunzip(),
+      _line(),
+      _mapped(NULL),
+      _mappedSize(0),
+      _cursor(0),
+      _header(),
+      _headerPending(false),
+      _records(0)
+{
+    if (_compressed)
+    {
+        _gunzip.start("gzip -dc -- " + shellQuote(file));
+    }
+    else
+    {
+        const int fd = open(file.c_str(), O_RDONLY);
+        mili::assert_throw<NotFoundFileException>(fd >= 0);
+        struct stat info;
+        if (fstat(fd, &info) == 0 && info.st_size > 0)
+        {
+            void* const address = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (address == MAP_FAILED)
+            {
+                close(fd);
+                throw RNABackendException("Could not map " + file);
+            }
+            madvise(address, info.st_size, MADV_SEQUENTIAL);
+            _mapped = static_cast<const char*>(address);
+            _mappedSize = info.st_size;
+        }
+        close(fd);
+    }
+}
+
+FastaReader::~FastaReader()
+{
+    if (_mapped != NULL)
+    {
+        munmap(const_cast<char*>(_mapped), _mappedSize);
+    }
+}
+
+bool FastaReader::nextLine(const char*& line, size_t& length)
+{
+    bool ret;
+    if (_compressed)
+    {
+        ret = _gunzip.running() && _gunzip.readLine(_line);
+        if (ret)
+        {
+            line = _line.data();
+            length = _line.size();
+        }
+        else if (_gunzip.running() && _gunzip.wait() != 0)
+        {
+            throw InvalidFastaFile("Could not decompress " + _file);
+        }
+    }
+    else
+    {
+        ret = _cursor < _mappedSize;
+        if (ret)
+        {
+            line = _mapped + _cursor;
+            const char* const end = static_cast<const char*>(memchr(line, '\n', _mappedSize - _cursor));
+            length = (end == NULL) ? _mappedSize - _cursor : size_t(end - line);
+            _cursor += length + 1;
+        }
+    }
+    if (ret && length > 0 && line[length - 1] == '\r')
+    {
+        --length;
+    }
+    return ret;
+}
+
+bool FastaReader::next(FastaRecord& record)
+{
+    const char* line;
+    size_t length;
+    while (!_headerPending && nextLine(line, length))
+    {
+        if (length > 0 && line[0] == HEADER_MARK)
+        {
+            _header.assign(line + 1, length - 1);
+            _headerPending = true;
+        }
+        else if (length > 0 && line[0] != COMMENT_MARK)
+        {
+            for (size_t i = 0; i < length; ++i)
+            {
+                if (!isspace(static_cast<unsigned char>(line[i])))
+                {
+                    throw InvalidFastaFile("Sequence without header in " + _file);
+                }
+            }
+        }
+    }
+    const bool ret = _headerPending;
+    if (ret)
+    {
+        record.index = _records++;
+        record.name.swap(_header);
+        record.sequence.clear();
+        _headerPending = false;
+        while (!_headerPending && nextLine(line, length))
+        {
+            if (length > 0 && line[0] == HEADER_MARK)
+            {
+                _header.assign(line + 1, length - 1);
+                _headerPending = true;
+            }
+            else if (length > 0 && line[0] != COMMENT_MARK)
+            {
+                for (size_t i = 0; i < length; ++i)
+                {
+                    if (!isspace(static_cast<unsigned char>(line[i])))
+                    {
+                        record.sequence += line[i];
+                    }
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+} //namespace fideo
@@ -97,5 +97,77 @@ void readLine(const FilePath& file, FileLineNo lineno, FileLine& line)
     }
 }
 
+void readFile(const FilePath& file, std::string& content)
+{
+    File in(file.c_str(), std::ios::binary);
+    mili::assert_throw<NotFoundFileException>(in);
+    in.seekg(0, std::ios::end);
+    const std::streamoff size = in.tellg();
+    in.seekg(0, std::ios::beg);
+    content.resize(size > 0 ? size_t(size) : 0);
+    if (!content.empty() && !in.read(&content[0], content.size()))
+    {
+        throw RNABackendException("An error ocurred trying to read " + file);
+    }
+}
+
+static const uint32_t CRC32_POLYNOMIAL = 0xEDB88320u;
+
+/** @brief Lookup table of the byte-wise CRC-32 algorithm
+ *
+ */
+struct Crc32Table
+{
+    Crc32Table()
+    {
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t c = i;
+            for (size_t k = 0; k < 8; ++k)
+            {
+                c = (c & 1) ? (CRC32_POLYNOMIAL ^ (c >> 1)) : (c >> 1);
+            }
+            entries[i] = c;
+        }
+    }
+
+    uint32_t entries[256];
+};
+
+uint32_t crc32(const void* data, const size_t length, const uint32_t crc)
+{
+    static const Crc32Table table;
+    const uint8_t* const bytes = static_cast<const uint8_t*>(data);
+    uint32_t c = crc ^ 0xFFFFFFFFu;
+    for (size_t i = 0; i < length; ++i)
+    {
+        c = table.entries[(c ^ bytes[i]) & 0xFF] ^ (c >> 8);
+    }
+    return c ^ 0xFFFFFFFFu;
+}
+
+static const uint64_t FNV_PRIME = 1099511628211ULL;
+
+uint64_t hash64(const void* data, const size_t length, const uint64_t hash)
+{
+    const uint8_t* const bytes = static_cast<const uint8_t*>(data);
+    uint64_t h = hash;
+    for (size_t i = 0; i < length; ++i)
+    {
+        h = (h ^ bytes[i]) * FNV_PRIME;
+    }
+    return h;
+}
+
+bool hasPopcount()
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    static const bool available = (__builtin_cpu_init(), __builtin_cpu_supports("popcnt") != 0);
+    return available;
+#else
+    return true;
+#endif
+}
+
 } //namespace helper
 } //namespace fideo
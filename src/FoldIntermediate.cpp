@@ -84,4 +84,31 @@ Fe IFoldIntermediate::foldFrom(const FilePath& inputFile, biopp::SecStructure& s
     return freeEnergy;
 }
 
+Fe IFoldIntermediate::foldEnergy(const biopp::NucSequence& seqRNAm, const bool isCircRNAm, const Temperature temp)
+{
+    InputFile inFile;
+    OutputFile outFile;
+    etilico::Command cmd;
+    prepareEnergyData(seqRNAm, isCircRNAm, cmd, inFile, outFile, temp);
+    etilico::runCommand(cmd);
+    Fe freeEnergy;
+    processingEnergy(outFile, freeEnergy);
+    deleteFilesAfterEnergy(inFile, outFile);
+    return freeEnergy;
+}
+
+void IFoldIntermediate::foldLazy(const biopp::NucSequence& seqRNAm, const bool isCircRNAm, FoldResult& result, const Temperature temp)
+{
+    InputFile inFile;
+    OutputFile outFile;
+    etilico::Command cmd;
+    prepareData(seqRNAm, isCircRNAm, cmd, inFile, outFile, temp);
+    etilico::runCommand(cmd);
+    PackedStructure packed;
+    Fe freeEnergy;
+    processingRawResult(outFile, packed, freeEnergy);
+    deleteAllFilesAfterProcessing(inFile, outFile);
+    result.assign(freeEnergy, isCircRNAm, packed);
+}
+
 } //namespace fideo
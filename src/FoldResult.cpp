@@ -0,0 +1,65 @@
+/*
+ * @file     FoldResult.cpp
+ * @brief    Provides a fold result that decodes its structure on demand.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Source file for fideo providing class FoldResult.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <algorithm>
+#include "fideo/FoldResult.h"
+
+namespace fideo
+{
+
+FoldResult::FoldResult()
+    : _energy(0), _circular(false), _decoded(false)
+{}
+
+void FoldResult::assign(const Fe freeEnergy, const bool isCirc, PackedStructure& packed)
+{
+    _energy = freeEnergy;
+    _circular = isCirc;
+    std::swap(_packed, packed);
+    _decoded = false;
+}
+
+const biopp::SecStructure& FoldResult::structure() const
+{
+    if (!_decoded)
+    {
+        _structure.clear();
+        _structure.set_circular(_circular);
+        _packed.unpack(_structure);
+        _decoded = true;
+    }
+    return _structure;
+}
+
+} //namespace fideo
@@ -0,0 +1,365 @@
+/*
+ * @file     FoldResultStore.cpp
+ * @brief    This is the implementation of the binary result store.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Source file for fideo providing FoldResultWriter and FoldResultReader implementation.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "fideo/FoldResultStore.h"
+
+namespace fideo
+{
+
+const char FoldResultStoreFormat::DATA_MAGIC[8] = {'F', 'I', 'D', 'E', 'O', 'R', 'E', 'S'};
+const char FoldResultStoreFormat::INDEX_MAGIC[8] = {'F', 'I', 'D', 'E', 'O', 'I', 'D', 'X'};
+const std::string FoldResultStoreFormat::INDEX_SUFFIX = ".idx";
+
+typedef FoldResultStoreFormat Format;
+
+/** @brief Checksum of the fields of an index entry that precede the entry checksum
+ *
+ */
+static uint32_t entryChecksum(const Format::IndexEntry& entry)
+{
+    return helper::crc32(&entry, offsetof(Format::IndexEntry, entryChecksum));
+}
+
+static size_t alignRecord(const size_t length)
+{
+    return (length + Format::RECORD_ALIGNMENT - 1) / Format::RECORD_ALIGNMENT * Format::RECORD_ALIGNMENT;
+}
+
+//------------------------------------- FoldResultWriter --------------------------------------
+
+FoldResultWriter::FoldResultWriter(const FilePath& file)
+    : _data(),
+      _index(),
+      _offset(0),
+      _buffer()
+{
+    recover(file);
+    _offset = open(file, Format::DATA_MAGIC, _data);
+    open(file + Format::INDEX_SUFFIX, Format::INDEX_MAGIC, _index);
+}
+
+FoldResultWriter::~FoldResultWriter()
+{
+    flush();
+}
+
+/** @brief Size of a file, 0 if it does not exist
+ *
+ */
+static uint64_t fileSize(const FilePath& path)
+{
+    struct stat info;
+    return stat(path.c_str(), &info) == 0 ? info.st_size : 0;
+}
+
+/** @brief Check the header of an existing store file
+ *
+ */
+static void checkHeader(const FilePath& path, const char* magic)
+{
+    File in(path.c_str(), std::ios::binary);
+    Format::FileHeader header;
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    mili::assert_throw<InvalidResultStore>(in && memcmp(header.magic, magic, sizeof(header.magic)) == 0 && header.version == Format::VERSION);
+}
+
+void FoldResultWriter::recover(const FilePath& file)
+{
+    const FilePath indexPath = file + Format::INDEX_SUFFIX;
+    const uint64_t dataSize = fileSize(file);
+    const uint64_t indexSize = fileSize(indexPath);
+    if (dataSize == 0)
+    {
+        //a new store: drop any index left without its data.
+        mili::assert_throw<InvalidResultStore>(indexSize == 0 || truncate(indexPath.c_str(), 0) == 0);
+        return;
+    }
+    checkHeader(file, Format::DATA_MAGIC);
+
+    //keep the longest prefix of entries that are whole and contiguous.
+    std::vector<Format::IndexEntry> entries;
+    if (indexSize >= sizeof(Format::FileHeader))
+    {
+        checkHeader(indexPath, Format::INDEX_MAGIC);
+        entries.resize((indexSize - sizeof(Format::FileHeader)) / sizeof(Format::IndexEntry));
+        File in(indexPath.c_str(), std::ios::binary);
+        in.seekg(sizeof(Format::FileHeader));
+        in.read(reinterpret_cast<char*>(entries.data()), entries.size() * sizeof(Format::IndexEntry));
+        mili::assert_throw<InvalidResultStore>(in);
+    }
+    size_t valid = 0;
+    uint64_t end = sizeof(Format::FileHeader);
+    while (valid < entries.size()
+            && entries[valid].entryChecksum == entryChecksum(entries[valid])
+            && entries[valid].offset == end
+            && end + entries[valid].length <= dataSize)
+    {
+        end += entries[valid].length;
+        ++valid;
+    }
+    //the streams are flushed independently, so the last entries may
+    //point to records that did not reach the disk whole.
+    File data(file.c_str(), std::ios::binary);
+    std::string record;
+    bool complete = false;
+    while (valid > 0 && !complete)
+    {
+        const Format::IndexEntry& entry = entries[valid - 1];
+        record.resize(entry.length);
+        data.seekg(entry.offset);
+        data.read(&record[0], entry.length);
+        complete = data && helper::crc32(record.data(), record.size()) == entry.recordChecksum;
+        if (!complete)
+        {
+            data.clear();
+            end = entry.offset;
+            --valid;
+        }
+    }
+    //cut the torn tails, so new records are appended right after the last valid one.
+    const uint64_t indexEnd = indexSize < sizeof(Format::FileHeader) ? 0 : sizeof(Format::FileHeader) + valid * sizeof(Format::IndexEntry);
+    if (indexSize != indexEnd)
+    {
+        mili::assert_throw<InvalidResultStore>(truncate(indexPath.c_str(), indexEnd) == 0);
+    }
+    if (dataSize != end)
+    {
+        mili::assert_throw<InvalidResultStore>(truncate(file.c_str(), end) == 0);
+    }
+}
+
+uint64_t FoldResultWriter::open(const FilePath& path, const char* magic, std::ofstream& out)
+{
+    const uint64_t size = fileSize(path);
+    if (size > 0)
+    {
+        checkHeader(path, magic);
+    }
+    out.open(path.c_str(), std::ios::binary | std::ios::app);
+    mili::assert_throw<InvalidResultStore>(out);
+    if (size == 0)
+    {
+        Format::FileHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, magic, sizeof(header.magic));
+        header.version = Format::VERSION;
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        return sizeof(header);
+    }
+    return size;
+}
+
+void FoldResultWriter::append(const FoldRecord& record)
+{
+    Format::RecordHeader header;
+    memset(&header, 0, sizeof(header));
+    header.idLength = record.sequenceId.size();
+    header.backendLength = record.backend.size();
+    header.structureSize = record.structure.size();
+    header.flags = record.circular ? Format::FLAG_CIRCULAR : 0;
+    header.temperature = record.temperature;
+    header.energy = record.energy;
+
+    _buffer.assign(reinterpret_cast<const char*>(&header), sizeof(header));
+    _buffer += record.sequenceId;
+    _buffer += record.backend;
+    const PackedStructure::Bytes& packed = record.structure.bytes();
+    _buffer.append(reinterpret_cast<const char*>(packed.data()), packed.size());
+    _buffer.resize(alignRecord(_buffer.size()), 0);
+
+    Format::IndexEntry entry;
+    memset(&entry, 0, sizeof(entry));
+    entry.offset = _offset;
+    entry.length = _buffer.size();
+    entry.recordChecksum = helper::crc32(_buffer.data(), _buffer.size());
+    entry.entryChecksum = entryChecksum(entry);
+
+    _data.write(_buffer.data(), _buffer.size());
+    _index.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+    mili::assert_throw<RNABackendException>(_data && _index);
+    _offset += _buffer.size();
+}
+
+void FoldResultWriter::flush()
+{
+    _data.flush();
+    _index.flush();
+}
+
+//------------------------------------- FoldResultReader --------------------------------------
+
+FoldResultReader::FoldResultReader(const FilePath& file)
+    : _entries(NULL),
+      _records(0)
+{
+    map(file, Format::DATA_MAGIC, _data);
+    try
+    {
+        map(file + Format::INDEX_SUFFIX, Format::INDEX_MAGIC, _index);
+    }
+    catch (...)
+    {
+        unmap(_data);
+        throw;
+    }
+    _entries = _index.data + sizeof(Format::FileHeader);
+    const size_t entries = (_index.size - sizeof(Format::FileHeader)) / sizeof(Format::IndexEntry);
+    //The valid records are the prefix of entries whose checksum is right.
+    bool valid = true;
+    while (_records < entries && valid)
+    {
+        Format::IndexEntry entry;
+        memcpy(&entry, _entries + _records * sizeof(entry), sizeof(entry));
+        valid = entry.entryChecksum == entryChecksum(entry) && entry.offset + entry.length <= _data.size;
+        if (valid)
+        {
+            ++_records;
+        }
+    }
+}
+
+FoldResultReader::~FoldResultReader()
+{
+    unmap(_index);
+    unmap(_data);
+}
+
+void FoldResultReader::map(const FilePath& path, const char* magic, MappedFile& mapped)
+{
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    mili::assert_throw<NotFoundFileException>(fd >= 0);
+    struct stat info;
+    if (fstat(fd, &info) != 0 || size_t(info.st_size) < sizeof(Format::FileHeader))
+    {
+        close(fd);
+        throw InvalidResultStore();
+    }
+    void* const address = mmap(NULL, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    mili::assert_throw<InvalidResultStore>(address != MAP_FAILED);
+    mapped.data = static_cast<const char*>(address);
+    mapped.size = info.st_size;
+
+    Format::FileHeader header;
+    memcpy(&header, mapped.data, sizeof(header));
+    if (memcmp(header.magic, magic, sizeof(header.magic)) != 0 || header.version != Format::VERSION)
+    {
+        unmap(mapped);
+        throw InvalidResultStore();
+    }
+}
+
+void FoldResultReader::unmap(MappedFile& mapped)
+{
+    if (mapped.data != NULL)
+    {
+        munmap(const_cast<char*>(mapped.data), mapped.size);
+        mapped.data = NULL;
+    }
+}
+
+const char* FoldResultReader::record(const size_t index, Format::RecordHeader& header) const
+{
+    mili::assert_throw<IndexOutOfRange>(index < _records);
+    Format::IndexEntry entry;
+    memcpy(&entry, _entries + index * sizeof(entry), sizeof(entry));
+    const char* const bytes = _data.data + entry.offset;
+    mili::assert_throw<CorruptedResultRecord>(entry.length >= sizeof(header) && helper::crc32(bytes, entry.length) == entry.recordChecksum);
+    memcpy(&header, bytes, sizeof(header));
+    mili::assert_throw<CorruptedResultRecord>(sizeof(header) + header.idLength + header.backendLength + PackedStructure::bytesFor(header.structureSize) <= entry.length);
+    return bytes;
+}
+
+void FoldResultReader::read(const size_t index, FoldRecord& record) const
+{
+    Format::RecordHeader header;
+    const char* bytes = this->record(index, header) + sizeof(header);
+    record.sequenceId.assign(bytes, header.idLength);
+    bytes += header.idLength;
+    record.backend.assign(bytes, header.backendLength);
+    bytes += header.backendLength;
+    record.structure.assign(reinterpret_cast<const uint8_t*>(bytes), header.structureSize);
+    record.temperature = header.temperature;
+    record.energy = header.energy;
+    record.circular = (header.flags & Format::FLAG_CIRCULAR) != 0;
+}
+
+Fe FoldResultReader::energy(const size_t index) const
+{
+    mili::assert_throw<IndexOutOfRange>(index < _records);
+    Format::IndexEntry entry;
+    memcpy(&entry, _entries + index * sizeof(entry), sizeof(entry));
+    mili::assert_throw<CorruptedResultRecord>(entry.length >= sizeof(Format::RecordHeader));
+    Format::RecordHeader header;
+    memcpy(&header, _data.data + entry.offset, sizeof(header));
+    return header.energy;
+}
+
+//------------------------------------- Pipelines --------------------------------------
+
+Fe foldToStore(IFold& folder, const std::string& backend, const std::string& sequenceId, const biopp::NucSequence& sequence, const bool isCirc, FoldResultWriter& store, const Temperature temp)
+{
+    FoldResult result;
+    folder.foldLazy(sequence, isCirc, result, temp);
+    FoldRecord record;
+    record.energy = result.energy();
+    record.sequenceId = sequenceId;
+    record.backend = backend;
+    record.temperature = temp;
+    record.circular = isCirc;
+    record.structure = result.packed();
+    store.append(record);
+    return record.energy;
+}
+
+Fe hybridizeToStore(const IHybridize& hybridizer, const std::string& backend, const std::string& pairId, const biopp::NucSequence& longerSeq, const bool longerCirc, const biopp::NucSequence& shorterSeq, FoldResultWriter& store, const Temperature temp)
+{
+    FoldRecord record;
+    record.energy = hybridizer.hybridize(longerSeq, longerCirc, shorterSeq, temp);
+    record.sequenceId = pairId;
+    record.backend = backend;
+    record.temperature = temp;
+    record.circular = longerCirc;
+    store.append(record);
+    return record.energy;
+}
+
+} //namespace fideo
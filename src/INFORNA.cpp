@@ -44,21 +44,20 @@ public:
     INFORNA(const InverseFoldParams& params);
 
 private:
-    static const FilePath OUT;
-    static const FileLineNo LINE_NO;
+    static const std::string RESULT_MARK;
+    static const std::string DISTANCE_MARK;
 
-    size_t read_sequence(FileLine&, size_t, std::string&) const;
-    size_t read_hamming_distance(FileLine&, size_t, Distance&) const;
-    size_t read_structure_distance(FileLine&, size_t, Similitude&) const;
+    bool parse_line(const FileLine&, Candidate&) const;
 
-    virtual void execute(std::string&, Distance&, Similitude&, const Temperature);
+    virtual void get_command(etilico::Command&, const Temperature) const;
+    virtual void parse_output(ChildProcess&, Candidates&) const;
     virtual void query_start(IStartProvider*);
 };
 
 REGISTER_FACTORIZABLE_CLASS_WITH_ARG(IFoldInverse, INFORNA, std::string, "INFORNA", const InverseFoldParams&);
 
-const FilePath INFORNA::OUT = "inverse.out"; //TODO: rename
-const FileLineNo INFORNA::LINE_NO = 13; //TODO: rename
+const std::string INFORNA::RESULT_MARK = "MFE:";
+const std::string INFORNA::DISTANCE_MARK = "d=";
 
 INFORNA::INFORNA(const InverseFoldParams& params) :
     RNAStartInverse(params)
@@ -71,24 +70,25 @@ void INFORNA::query_start(IStartProvider* provider)
         throw RNABackendException("Partial start and target structure must have the same length");
 }
 
-void INFORNA::execute(std::string& seq, Distance& hd, Similitude& sd, const Temperature /*temp*/)
+void INFORNA::get_command(etilico::Command& cmd, const Temperature /*temp*/) const
 {
     std::stringstream ss;
-    const int repeat = max_structure_distance == 0 ? -1 : 1;
+    //A negative repeat only prints the successful designs.
+    const int designs = int(designs_per_run);
+    const int repeat = (max_structure_distance == 0) ? -designs : designs;
     std::string structure_str;
     ViennaParser::toString(structure, structure_str);    
 
     ss << "INFO-RNA-2.1.2 '" << structure_str << "'"
        << " -c '" << start << "'"
-       << " -R " << repeat << " > " << OUT;
+       << " -R " << repeat;
 
-    const etilico::Command CMD  = ss.str();
-
-    etilico::runCommand(CMD);
+    cmd = ss.str();
+}
 
-    FileLine aux;//TODO: rename
-    fideo::helper::readLine(OUT, LINE_NO, aux);
-    /* inverse.out looks like this:
+void INFORNA::parse_output(ChildProcess& process, Candidates& found) const
+{
+    /* the output looks like this:
      *
      * =========================
      * Initializing Step:
@@ -105,63 +105,46 @@ void INFORNA::execute(std::string& seq, Distance& hd, Similitude& sd, const Temp
      * MFE:    GUAGCUUUAUGCCGC    0  (-1.70)   d= 1
      * number of mismatches: 0
      *
+     * with one block per design; only the result lines are kept.
      */
-    //sequence found
-    const size_t hd_offset = read_sequence(aux, 4, seq);
-    //hamming distance from the start used
-    const size_t sd_offset = read_hamming_distance(aux, hd_offset, hd);
-    //structure distance from the sequence found to the target structure.
-    read_structure_distance(aux, sd_offset, sd);
-}
-
-size_t INFORNA::read_sequence(FileLine& line, size_t offset, string& seq) const
-{
-    try
-    {
-        const size_t from = mili::ensure_found(line.find_first_not_of(" ", offset));
-        const size_t to = mili::ensure_found(line.find_first_of(" ", from));
-        fideo::helper::readValue(line, from, to - from, seq);
-
-        for (size_t i = 0; i < seq.size(); ++i)
-            seq[i] = tolower(seq[i]);
-
-        return to;
-    }
-    catch (const mili::StringNotFound& e)
+    FileLine aux;
+    while (process.readLine(aux))
     {
-        throw RNABackendException("Could not read sequence");
+        Candidate candidate;
+        if (parse_line(aux, candidate))
+            found.push_back(candidate);
     }
+    if (found.empty())
+        throw RNABackendException("Could not read INFO-RNA output");
 }
 
-size_t INFORNA::read_hamming_distance(FileLine& line, size_t offset, Distance& hd) const
+bool INFORNA::parse_line(const FileLine& line, Candidate& candidate) const
 {
-    try
-    {
-        const size_t from = mili::ensure_found(line.find_first_not_of(" ", offset));
-        const size_t to = mili::ensure_found(line.find_first_of(" ", from));
-        fideo::helper::readValue(line, from, to - from, hd);
-        return to;
-    }
-    catch (const mili::StringNotFound& e)
-    {
-        throw RNABackendException("Could not read hamming distance");
-    }
-}
-
-size_t INFORNA::read_structure_distance(FileLine& line, size_t offset, Similitude& sd) const
-{
-    try
-    {
-        const size_t from = mili::ensure_found(line.find_first_of("d", offset)) + 3;
-        const size_t to = line.size();
-        fideo::helper::readValue(line, from, to - from, sd);
-        return to;
-    }
-    catch (const mili::StringNotFound& e)
+    std::istringstream fields(line);
+    std::string mark;
+    if (!(fields >> mark) || mark != RESULT_MARK)
+        return false;
+
+    //sequence found and hamming distance from the start used
+    if (!(fields >> candidate.seq >> candidate.hd))
+        throw RNABackendException("Could not read INFO-RNA result");
+    for (size_t i = 0; i < candidate.seq.size(); ++i)
+        candidate.seq[i] = tolower(candidate.seq[i]);
+
+    //structure distance to the target, only printed when it is not reached.
+    candidate.sd = 0;
+    std::string field;
+    while (fields >> field)
     {
-        sd = 0;
-        return line.size();
+        if (field.compare(0, DISTANCE_MARK.size(), DISTANCE_MARK) == 0)
+        {
+            field.erase(0, DISTANCE_MARK.size());
+            if (field.empty() && !(fields >> field))
+                throw RNABackendException("Could not read structure distance");
+            fideo::helper::readValue(field, candidate.sd);
+        }
     }
+    return true;
 }
 
 class INFORNATest : public INFORNA
@@ -0,0 +1,188 @@
+/*
+ * @file     LoopDecomposition.cpp
+ * @brief    Decomposition of secondary structures in loops.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Implementation of the loop decomposition.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include "fideo/LoopDecomposition.h"
+#include "fideo/RnaBackendsException.h"
+
+namespace fideo
+{
+
+/**
+ * Pair table of a structure and the walks over its loops.
+ */
+class LoopWalker
+{
+public:
+    typedef std::pair<size_t, size_t> Pair;
+    typedef std::vector<Pair> Pairs;
+
+    explicit LoopWalker(const biopp::SecStructure& structure)
+        : partners(structure.size(), UNPAIRED)
+    {
+        for (biopp::SeqIndex i = 0; i < structure.size(); ++i)
+        {
+            if (structure.is_paired(i))
+                partners[i] = long(structure.paired_with(i));
+        }
+    }
+
+    /**
+     * Scans the bases enclosed by a pair, or the whole structure for the
+     * external loop, following each helix branching from it.
+     * @param first: first base of the loop.
+     * @param last: one past the last base of the loop.
+     * @param unpaired: to fill with the unpaired bases of the loop.
+     * @param stacks: to fill with the stacked pairs of the branches.
+     * @param branches: to fill with the outer pair of each branch.
+     * @param inner: to fill with the pair closing the loop of each branch.
+     */
+    void scan(const size_t first, const size_t last, size_t& unpaired, size_t& stacks, Pairs& branches, Pairs& inner) const
+    {
+        unpaired = 0;
+        stacks = 0;
+        branches.clear();
+        inner.clear();
+        for (size_t k = first; k < last; ++k)
+        {
+            const long partner = partners[k];
+            if (partner == UNPAIRED)
+            {
+                ++unpaired;
+            }
+            else
+            {
+                if (partner < long(k) || partner >= long(last))
+                    throw InvalidStructureException("Crossing pairs");
+                size_t i = k;
+                size_t j = size_t(partner);
+                branches.push_back(Pair(i, j));
+                while (i + 1 < j - 1 && partners[i + 1] == long(j - 1))
+                {
+                    ++i;
+                    --j;
+                    ++stacks;
+                }
+                inner.push_back(Pair(i, j));
+                k = size_t(partner);
+            }
+        }
+    }
+
+    size_t size() const
+    {
+        return partners.size();
+    }
+
+private:
+    static const long UNPAIRED = -1;
+    std::vector<long> partners;
+};
+
+const long LoopWalker::UNPAIRED;
+
+void decomposeLoops(const biopp::SecStructure& structure, std::vector<MotifRecord>& records)
+{
+    records.clear();
+    const LoopWalker walker(structure);
+    LoopWalker::Pairs branches;
+    LoopWalker::Pairs inner;
+    size_t unpaired;
+    size_t stacks;
+    MotifRecord record;
+
+    walker.scan(0, walker.size(), unpaired, stacks, branches, inner);
+    record.kind = MotifExternalLoop;
+    record.first = 0;
+    record.last = uint32_t(walker.size() == 0 ? 0 : walker.size() - 1);
+    record.attribute = uint32_t(unpaired);
+    record.amountStacks = uint32_t(stacks);
+    records.push_back(record);
+
+    //loops still to report, the next one at the back.
+    LoopWalker::Pairs pending(inner.rbegin(), inner.rend());
+    while (!pending.empty())
+    {
+        const size_t i = pending.back().first;
+        const size_t j = pending.back().second;
+        pending.pop_back();
+        walker.scan(i + 1, j, unpaired, stacks, branches, inner);
+        size_t attribute;
+        switch (branches.size())
+        {
+            case 0:
+                record.kind = MotifHairpinLoop;
+                attribute = j - i;
+                break;
+            case 1:
+            {
+                const size_t left = branches[0].first - i;
+                const size_t right = j - branches[0].second;
+                if (left == 1 || right == 1)
+                {
+                    record.kind = MotifBulgeLoop;
+                    attribute = left == 1 ? right : left;
+                }
+                else
+                {
+                    record.kind = left == right ? MotifInteriorSymmetric : MotifInteriorAsymmetric;
+                    attribute = std::max(left, right);
+                }
+                break;
+            }
+            default:
+                record.kind = MotifMultiLoop;
+                attribute = unpaired;
+                break;
+        }
+        record.first = uint32_t(i);
+        record.last = uint32_t(j);
+        record.attribute = uint32_t(attribute);
+        record.amountStacks = uint32_t(stacks);
+        records.push_back(record);
+        pending.insert(pending.end(), inner.rbegin(), inner.rend());
+    }
+}
+
+void decomposeLoops(const biopp::SecStructure& structure, IMotifObserver& observer)
+{
+    std::vector<MotifRecord> records;
+    decomposeLoops(structure, records);
+    observer.processMotifs(records.data(), records.data() + records.size());
+}
+
+} //namespace fideo
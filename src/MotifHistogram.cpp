@@ -0,0 +1,98 @@
+/*
+ * @file     MotifHistogram.cpp
+ * @brief    Motif statistics kept in flat histograms.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Implementation of class MotifHistogram.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#include "fideo/MotifHistogram.h"
+#include "fideo/RnaBackendsException.h"
+
+namespace fideo
+{
+
+MotifHistogram::MotifHistogram(const size_t attributeBins, const size_t stacksBins)
+    : _attributeBins(attributeBins), _stacksBins(stacksBins), _structures(0),
+      _motifs(MotifKinds, 0), _attributes(MotifKinds * attributeBins, 0), _stacks(MotifKinds * stacksBins, 0)
+{
+    mili::assert_throw<RNABackendException>(attributeBins > 0 && stacksBins > 0);
+}
+
+void MotifHistogram::start()
+{}
+
+void MotifHistogram::processMotif(const Motif& motif)
+{
+    MotifKind kind;
+    mili::assert_throw<InvalidMotif>(motifKind(motif.nameMotif, kind));
+    add(kind, motif.attribute, motif.amountStacks);
+}
+
+void MotifHistogram::processMotifs(const MotifRecord* first, const MotifRecord* last)
+{
+    for (const MotifRecord* record = first; record != last; ++record)
+    {
+        mili::assert_throw<InvalidMotif>(record->kind < MotifKinds);
+        add(MotifKind(record->kind), record->attribute, record->amountStacks);
+    }
+    ++_structures;
+}
+
+void MotifHistogram::finalize()
+{}
+
+void MotifHistogram::merge(const MotifHistogram& other)
+{
+    mili::assert_throw<RNABackendException>(_attributeBins == other._attributeBins && _stacksBins == other._stacksBins);
+    _structures += other._structures;
+    for (size_t i = 0; i < _motifs.size(); ++i)
+    {
+        _motifs[i] += other._motifs[i];
+    }
+    for (size_t i = 0; i < _attributes.size(); ++i)
+    {
+        _attributes[i] += other._attributes[i];
+    }
+    for (size_t i = 0; i < _stacks.size(); ++i)
+    {
+        _stacks[i] += other._stacks[i];
+    }
+}
+
+void MotifHistogram::clear()
+{
+    _structures = 0;
+    std::fill(_motifs.begin(), _motifs.end(), 0);
+    std::fill(_attributes.begin(), _attributes.end(), 0);
+    std::fill(_stacks.begin(), _stacks.end(), 0);
+}
+
+} //namespace fideo
@@ -0,0 +1,144 @@
+/*
+ * @file     PackedSequence.cpp
+ * @brief    Provides a compact 2-bit representation of nucleotide sequences.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Source file for fideo providing class PackedSequence.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#include "fideo/PackedSequence.h"
+#include "fideo/FideoHelper.h"
+
+namespace fideo
+{
+
+static const char BASES[] = "acgu";
+
+static uint64_t baseCode(const char base)
+{
+    switch (base)
+    {
+        case 'a':
+        case 'A':
+            return 0;
+        case 'c':
+        case 'C':
+            return 1;
+        case 'g':
+        case 'G':
+            return 2;
+        case 't':
+        case 'T':
+        case 'u':
+        case 'U':
+            return 3;
+        default:
+            throw UnsupportedException();
+    }
+}
+
+PackedSequence::PackedSequence()
+    : _bases(0),
+      _words()
+{}
+
+PackedSequence::PackedSequence(const std::string& sequence)
+    : _bases(0),
+      _words()
+{
+    pack(sequence);
+}
+
+void PackedSequence::pack(const std::string& sequence)
+{
+    _bases = sequence.size();
+    _words.assign(wordsFor(_bases), 0);
+    for (size_t i = 0; i < _bases; ++i)
+    {
+        _words[i / BASES_PER_WORD] |= baseCode(sequence[i]) << ((i % BASES_PER_WORD) * BITS_PER_BASE);
+    }
+}
+
+void PackedSequence::assign(const uint64_t* words, const size_t bases)
+{
+    _bases = bases;
+    _words.assign(words, words + wordsFor(bases));
+}
+
+void PackedSequence::unpack(std::string& sequence) const
+{
+    sequence.resize(_bases);
+    for (size_t i = 0; i < _bases; ++i)
+    {
+        sequence[i] = BASES[(_words[i / BASES_PER_WORD] >> ((i % BASES_PER_WORD) * BITS_PER_BASE)) & 0x3];
+    }
+}
+
+uint64_t PackedSequence::hash() const
+{
+    const uint64_t bases = _bases;
+    const uint64_t h = helper::hash64(&bases, sizeof(bases));
+    return _words.empty() ? h : helper::hash64(&_words[0], _words.size() * sizeof(uint64_t), h);
+}
+
+FIDEO_TARGET_POPCNT
+static size_t hammingPopcount(const uint64_t* a, const uint64_t* b, const size_t words)
+{
+    size_t distance = 0;
+    for (size_t i = 0; i < words; ++i)
+    {
+        distance += size_t(__builtin_popcountll(PackedSequence::differingBases(a[i], b[i])));
+    }
+    return distance;
+}
+
+static size_t hammingArithmetic(const uint64_t* a, const uint64_t* b, const size_t words)
+{
+    size_t distance = 0;
+    for (size_t i = 0; i < words; ++i)
+    {
+        distance += PackedSequence::differingBasesArithmetic(a[i], b[i]);
+    }
+    return distance;
+}
+
+size_t PackedSequence::hamming(const uint64_t* a, const uint64_t* b, const size_t words)
+{
+    static const bool hardware = helper::hasPopcount();
+    return hardware ? hammingPopcount(a, b, words) : hammingArithmetic(a, b, words);
+}
+
+size_t PackedSequence::hamming(const PackedSequence& other) const
+{
+    mili::assert_throw<IndexOutOfRange>(_bases == other._bases);
+    return _words.empty() ? 0 : hamming(&_words[0], &other._words[0], _words.size());
+}
+
+} //namespace fideo
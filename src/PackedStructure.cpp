@@ -0,0 +1,153 @@
+/*
+ * @file     PackedStructure.cpp
+ * @brief    This is the implementation of PackedStructure class.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Source file for fideo providing class PackedStructure implementation.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "fideo/PackedStructure.h"
+#include "fideo/FideoStructureParser.h"
+
+namespace fideo
+{
+
+PackedStructure::PackedStructure()
+    : _positions(0),
+      _bytes()
+{}
+
+void PackedStructure::reset(const size_t positions)
+{
+    _positions = positions;
+    _bytes.assign(bytesFor(positions), 0);
+}
+
+void PackedStructure::set(const size_t pos, const Symbol symbol)
+{
+    _bytes[pos / SYMBOLS_PER_BYTE] |= uint8_t(symbol << ((pos % SYMBOLS_PER_BYTE) * BITS_PER_SYMBOL));
+}
+
+PackedStructure::Symbol PackedStructure::get(const size_t pos) const
+{
+    return Symbol((_bytes[pos / SYMBOLS_PER_BYTE] >> ((pos % SYMBOLS_PER_BYTE) * BITS_PER_SYMBOL)) & 0x3);
+}
+
+void PackedStructure::pack(const biopp::SecStructure& structure)
+{
+    reset(structure.size());
+    for (biopp::SeqIndex i = 0; i < structure.size(); ++i)
+    {
+        if (structure.is_paired(i))
+        {
+            set(i, i < structure.paired_with(i) ? SymbolOpen : SymbolClose);
+        }
+    }
+}
+
+void PackedStructure::pack(const std::string& dotBracket)
+{
+    reset(dotBracket.size());
+    for (size_t i = 0; i < dotBracket.size(); ++i)
+    {
+        switch (dotBracket[i])
+        {
+            case ViennaParser::UNPAIR:
+                break;
+            case ViennaParser::OPEN_PAIR:
+                set(i, SymbolOpen);
+                break;
+            case ViennaParser::CLOSE_PAIR:
+                set(i, SymbolClose);
+                break;
+            default:
+                throw InvalidStructureException("Unexpected symbol: " + dotBracket.substr(i, 1));
+        }
+    }
+}
+
+void PackedStructure::assign(const uint8_t* data, const size_t positions)
+{
+    _positions = positions;
+    _bytes.assign(data, data + bytesFor(positions));
+}
+
+void PackedStructure::unpack(biopp::SecStructure& structure) const
+{
+    structure.set_sequence_size(_positions);
+    std::vector<biopp::SeqIndex> opened;
+    for (size_t i = 0; i < _positions; ++i)
+    {
+        switch (get(i))
+        {
+            case SymbolUnpaired:
+                structure.unpair(i);
+                break;
+            case SymbolOpen:
+                opened.push_back(i);
+                break;
+            case SymbolClose:
+                if (opened.empty())
+                {
+                    throw InvalidStructureException("Unexpected closing pair");
+                }
+                structure.pair(opened.back(), i);
+                opened.pop_back();
+                break;
+            default:
+                throw InvalidStructureException("Invalid packed symbol");
+        }
+    }
+    if (!opened.empty())
+    {
+        throw InvalidStructureException("Pairs pending to close");
+    }
+}
+
+void PackedStructure::toString(std::string& dotBracket) const
+{
+    dotBracket.resize(_positions);
+    for (size_t i = 0; i < _positions; ++i)
+    {
+        switch (get(i))
+        {
+            case SymbolOpen:
+                dotBracket[i] = ViennaParser::OPEN_PAIR;
+                break;
+            case SymbolClose:
+                dotBracket[i] = ViennaParser::CLOSE_PAIR;
+                break;
+            default:
+                dotBracket[i] = ViennaParser::UNPAIR;
+                break;
+        }
+    }
+}
+
+} //namespace fideo
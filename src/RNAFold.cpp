@@ -34,10 +34,12 @@
  *
  */
 
-#include <stack>
 #define RNA_FOLD_H
 #include "fideo/RNAFold.h"
 #undef RNA_FOLD_H
+#include "fideo/RNAFoldOutputParser.h"
+#include "fideo/FideoStructureParser.h"
+#include "fideo/LoopDecomposition.h"
 
 /** @brief Temporal method requerid to execute remo
  *
@@ -54,72 +56,8 @@ fideo::IFold* getDerivedFold(const std::string& derivedKey)
 namespace fideo
 {
 
-const FileLineNo RNAFold::LINE_NO = 1;
-
 REGISTER_FACTORIZABLE_CLASS(IFold, RNAFold, std::string, "RNAFold");
 
-size_t RNAFold::readFreeEnergy(FileLine& line, size_t offset, Fe& energy) const
-{
-    try
-    {
-        const size_t from = mili::ensure_found(line.find_first_of("(", offset)) + 1;
-        const size_t to = mili::ensure_found(line.find_first_of(")", from)) - 1;
-        helper::readValue(line, from, to - from, energy);
-        return to;
-    }
-    catch (const mili::StringNotFound& e)
-    {
-        throw RNABackendException("Could not read free energy");
-    }
-}
-
-void RNAFold::parseStructure(std::string& str, biopp::SecStructure& secStructure)
-{
-    secStructure.set_sequence_size(str.length());
-    std::stack<biopp::SeqIndex> stackIndex;
-    for (size_t i = 0; i < str.length(); ++i)
-    {
-        biopp::SeqIndex open;
-        switch (str[i])
-        {
-            case UNPAIR:
-                secStructure.unpair(i);
-                break;
-            case OPEN_PAIR:
-                stackIndex.push(i);
-                break;
-            case CLOSE_PAIR:
-                if (!stackIndex.empty())
-                {
-                    open = stackIndex.top();
-                    secStructure.pair(open, i);
-                    stackIndex.pop();
-                }
-                else
-                {
-                    throw InvalidStructureException("Unexpected closing pair");
-                }
-                break;
-            default:
-                throw InvalidStructureException("Unexpected symbol: " + secStructure.paired_with(i));
-                break;
-        }
-    }
-    if (!stackIndex.empty())
-    {
-        throw InvalidStructureException("Pairs pending to close");
-    }
-}
-
-size_t RNAFold::getSizeOfSequence(const FilePath& file) const
-{
-    File fileIn(file.c_str());
-    mili::assert_throw<NotFoundFileException>(fileIn);
-    std::string lineSequence;
-    getline(fileIn, lineSequence);
-    return lineSequence.length();
-}
-
 void RNAFold::renameNecessaryFiles(const std::string& fileToRename, const std::string& newNameFile)
 {
     etilico::Command renameCmd = "mv " + fileToRename + " " + newNameFile;
@@ -156,14 +94,16 @@ void RNAFold::prepareData(const biopp::NucSequence& sequence, const bool isCirc,
 
 void RNAFold::processingResult(biopp::SecStructure& structureRNAm, const InputFile& inputFile, Fe& freeEnergy)
 {
-    const size_t sizeSequence = getSizeOfSequence(inputFile);
-    FileLine aux;
-    helper::readLine(inputFile, LINE_NO, aux);
-
-    std::string str;
-    helper::readValue(aux, 0, sizeSequence, str);
-    parseStructure(str, structureRNAm);
-    readFreeEnergy(aux, sizeSequence, freeEnergy);
+    std::string output;
+    helper::readFile(inputFile, output);
+    RNAFoldOutputParser parser(output.data(), output.data() + output.size());
+    RNAFoldRecord record;
+    if (!parser.next(record))
+    {
+        throw RNABackendException("Empty RNAfold output");
+    }
+    ViennaParser::parseStructure(record.structure, structureRNAm);
+    freeEnergy = record.energy;
 }
 
 void RNAFold::deleteAllFilesAfterProcessing(const InputFile& inFile, const OutputFile& outFile)
@@ -172,18 +112,75 @@ void RNAFold::deleteAllFilesAfterProcessing(const InputFile& inFile, const Outpu
     mili::assert_throw<UnlinkException>(unlink(outFile.c_str()) == 0);
 }
 
-Fe RNAFold::fold(const biopp::NucSequence& /*seqRNAm*/, const bool /*isCircRNAm*/, biopp::SecStructure& /*structureRNAm*/, IMotifObserver* /*motifObserver*/, const Temperature /*temp*/)
+void RNAFold::prepareEnergyData(const biopp::NucSequence& sequence, const bool isCirc, etilico::Command& command, InputFile& inputFile, OutputFile& outputFile, const Temperature temp)
 {
-    return 0; //temporal
+    /// RNAfold has no energy-only switch: the traceback is cheap, so run the same command and skip the structure
+    prepareData(sequence, isCirc, command, inputFile, outputFile, temp);
 }
 
-//temporal
-void RNAFold::foldTo(const biopp::NucSequence& /*seqRNAm*/, const bool /*isCircRNAm*/, biopp::SecStructure& /*structureRNAm*/, const FilePath& /*outputFile*/, IMotifObserver* /*motifObserver*/, const Temperature /*temp*/)
-{}
+void RNAFold::processingEnergy(const OutputFile& outputFile, Fe& freeEnergy)
+{
+    std::string output;
+    helper::readFile(outputFile, output);
+    RNAFoldOutputParser parser(output.data(), output.data() + output.size());
+    if (!parser.nextEnergy(freeEnergy))
+    {
+        throw RNABackendException("Empty RNAfold output");
+    }
+}
+
+void RNAFold::deleteFilesAfterEnergy(const InputFile& inFile, const OutputFile& outFile)
+{
+    deleteAllFilesAfterProcessing(inFile, outFile);
+}
+
+void RNAFold::processingRawResult(const InputFile& inputFile, PackedStructure& structure, Fe& freeEnergy)
+{
+    std::string output;
+    helper::readFile(inputFile, output);
+    RNAFoldOutputParser parser(output.data(), output.data() + output.size());
+    RNAFoldRecord record;
+    if (!parser.next(record))
+    {
+        throw RNABackendException("Empty RNAfold output");
+    }
+    structure.pack(record.structure);
+    freeEnergy = record.energy;
+}
+
+/** @brief Report the loops of a folded structure, as UNAFold does from its .det file
+ *
+ * @param structure: the structure folded
+ * @param motifObserver: observer to notify, may be NULL
+ * @return void
+ */
+static void notifyMotifs(const biopp::SecStructure& structure, IMotifObserver* motifObserver)
+{
+    if (motifObserver != NULL)
+    {
+        decomposeLoops(structure, *motifObserver);
+        motifObserver->finalize();
+    }
+}
+
+Fe RNAFold::fold(const biopp::NucSequence& seqRNAm, const bool isCircRNAm, biopp::SecStructure& structureRNAm, IMotifObserver* motifObserver, const Temperature temp)
+{
+    const Fe freeEnergy = IFoldIntermediate::fold(seqRNAm, isCircRNAm, structureRNAm, temp);
+    notifyMotifs(structureRNAm, motifObserver);
+    return freeEnergy;
+}
+
+void RNAFold::foldTo(const biopp::NucSequence& seqRNAm, const bool isCircRNAm, biopp::SecStructure& structureRNAm, const FilePath& outputFile, IMotifObserver* motifObserver, const Temperature temp)
+{
+    IFoldIntermediate::foldTo(seqRNAm, isCircRNAm, structureRNAm, outputFile, temp);
+    notifyMotifs(structureRNAm, motifObserver);
+}
 
-Fe RNAFold::foldFrom(const FilePath& /*inputFile*/, biopp::SecStructure& /*structureRNAm*/, IMotifObserver* /*motifObserver*/)
+Fe RNAFold::foldFrom(const FilePath& inputFile, biopp::SecStructure& structureRNAm, IMotifObserver* motifObserver)
 {
-    return 0; //temporal
+    const Fe freeEnergy = IFoldIntermediate::foldFrom(inputFile, structureRNAm);
+    notifyMotifs(structureRNAm, motifObserver);
+    return freeEnergy;
 }
 
 } //namespace fideo
@@ -44,22 +44,20 @@ namespace fideo
 
 class RNAinverse : public RNAStartInverse
 {
-    static const FilePath IN;
-    static const FilePath OUT;
     static const FileLineNo LINE_NO;
 
     size_t read_hamming_distance(FileLine&, size_t, Distance&) const;
     size_t read_structure_distance(FileLine&, size_t, Similitude&) const;
+    void parse_line(FileLine&, Candidate&) const;
 
-    virtual void execute(std::string&, Distance&, Similitude&, const Temperature);
+    virtual void get_command(etilico::Command&, const Temperature) const;
+    virtual void parse_output(ChildProcess&, Candidates&) const;
     virtual void query_start(IStartProvider*);
 
 public:
     RNAinverse(const InverseFoldParams& params);
 };
 
-const FilePath RNAinverse::IN = "inverse.in";
-const FilePath RNAinverse::OUT = "inverse.out";
 const FileLineNo RNAinverse::LINE_NO = 0;
 
 REGISTER_FACTORIZABLE_CLASS_WITH_ARG(IFoldInverse, RNAinverse, std::string, "RNAinverse", const InverseFoldParams&);
@@ -75,46 +73,66 @@ void RNAinverse::query_start(IStartProvider* provider)
         throw RNABackendException("Partial start and target structure must have the same length");
 }
 
-void RNAinverse::execute(std::string& seq, Distance& hd, Similitude& sd, const Temperature temp)
+void RNAinverse::get_command(etilico::Command& cmd, const Temperature temp) const
 {
-    FileLinesCt lines;
     std::string structure_str;
     ViennaParser::toString(structure, structure_str);
-    mili::insert_into(lines, structure_str);
-    mili::insert_into(lines, start);
-    fideo::helper::write(IN, lines);
 
     std::stringstream ss;
-    const int repeat = (max_structure_distance == 0) ? -1 : 1;
+    //A negative repeat only prints the successful designs.
+    const int designs = int(designs_per_run);
+    const int repeat = (max_structure_distance == 0) ? -designs : designs;
 
-    ss << "RNAinverse -R " << repeat << " -a ATGC --temp=" << temp << " < " << IN << " > " << OUT;
-    const etilico::Command CMD = ss.str();
+    //The input goes through a pipe, so concurrent runs share no file.
+    ss << "printf '%s\\n%s\\n' '" << structure_str << "' '" << start << "'"
+       << " | RNAinverse -R " << repeat << " -a ATGC --temp=" << temp;
 
-    //CMD looks like "RNAinverse -R -1 -a ATGC --temp=temp < inverse.in > inverse.out"
-    etilico::runCommand(CMD);
+    //cmd looks like "printf '%s\n%s\n' 'structure' 'start' | RNAinverse -R -1 -a ATGC --temp=temp"
+    cmd = ss.str();
+}
 
-    //BUG: inverse.out looks like "TGCCTGTACTCATTAATGGAACTTCcuaccagucgcgau    6"
+void RNAinverse::parse_output(ChildProcess& process, Candidates& found) const
+{
+    //One line per design, all parsed in this pass.
     FileLine aux;
-    fideo::helper::readLine(OUT, LINE_NO, aux);
-
-    // If the the search was unsuccessful, a structure distance to the target is appended.
+    for (FileLineNo i = 0; i < LINE_NO; ++i)
+    {
+        if (!process.readLine(aux))
+            throw RNABackendException("Could not read RNAinverse output");
+    }
+    while (process.readLine(aux))
+    {
+        if (aux.empty())
+            continue;
+        Candidate candidate;
+        parse_line(aux, candidate);
+        found.push_back(candidate);
+    }
+    if (found.empty())
+        throw RNABackendException("Could not read RNAinverse output");
+}
 
+void RNAinverse::parse_line(FileLine& aux, Candidate& candidate) const
+{
     /* aux looks like this
-     * accagggATCgcaggtaccccgcaGGcgcagAacccta   5 2   d= 2
+     * accagggATCgcaggtaccccgcaGGcgcagAacccta   5   d= 2
      *
      * where uppercases were set by RNAinverse (dots in our start).
      * 5 it's the hamming distance from the random generated start and the
-     * sequence found. And 2 it's the structure distance to the target structure.
-     * If max_structure_distance=0 then, this will be also equal to 0.
+     * sequence found. If the the search was unsuccessful, the structure
+     * distance to the target structure is appended; otherwise it's 0.
      */
-    fideo::helper::readValue(aux, 0, start.size(), seq);
+    fideo::helper::readValue(aux, 0, start.size(), candidate.seq);
     for (size_t i = 0; i < start.size(); ++i)
-        seq[i] = tolower(seq[i]);
+        candidate.seq[i] = tolower(candidate.seq[i]);
 
     //hamming distance from the start used
-    const size_t sd_offset = read_hamming_distance(aux, start.size(), hd);
+    const size_t sd_offset = read_hamming_distance(aux, start.size(), candidate.hd);
     //structure distance from the sequence found to the target structure.
-    read_structure_distance(aux, sd_offset, sd);
+    if (aux.find_first_not_of(" ", sd_offset) == std::string::npos)
+        candidate.sd = 0;
+    else
+        read_structure_distance(aux, sd_offset, candidate.sd);
 }
 
 size_t RNAinverse::read_hamming_distance(FileLine& line, size_t offset, Distance& hd) const
@@ -122,7 +140,7 @@ size_t RNAinverse::read_hamming_distance(FileLine& line, size_t offset, Distance
     try
     {
         const size_t from = mili::ensure_found(line.find_first_not_of(" ", offset));
-        const size_t to = mili::ensure_found(line.find_first_of(" ", from));
+        const size_t to = mili::ensure_found(line.find_first_of(" ", from), line.size());
         fideo::helper::readValue(line, from, to - from, hd);
         return to;
     }
@@ -138,6 +156,10 @@ size_t RNAinverse::read_hamming_distance(FileLine& line, size_t offset, Distance
 
 size_t RNAinverse::read_structure_distance(FileLine& line, size_t offset, Similitude& sd) const
 {
+    //skip the "d=" mark of unsuccessful searches
+    const size_t mark = line.find("d=", offset);
+    if (mark != std::string::npos)
+        offset = mark + 2;
     try
     {
         const size_t from = mili::ensure_found(line.find_first_not_of(" ", offset));
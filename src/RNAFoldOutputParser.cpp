@@ -0,0 +1,188 @@
+/*
+ * @file     RNAFoldOutputParser.cpp
+ * @brief    This is the implementation of RNAFoldOutputParser class.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Source file for fideo providing class RNAFoldOutputParser implementation.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include "fideo/RNAFoldOutputParser.h"
+
+namespace fideo
+{
+
+static const char HEADER_MARK = '>';
+static const char OPEN_ENERGY = '(';
+static const char CLOSE_ENERGY = ')';
+
+RNAFoldOutputParser::RNAFoldOutputParser(const char* begin, const char* end)
+    : _cursor(begin),
+      _end(end)
+{}
+
+void RNAFoldOutputParser::takeLine(const char*& line, const char*& lineEnd)
+{
+    line = _cursor;
+    lineEnd = static_cast<const char*>(memchr(_cursor, '\n', _end - _cursor));
+    if (lineEnd == NULL)
+    {
+        lineEnd = _end;
+        _cursor = _end;
+    }
+    else
+    {
+        _cursor = lineEnd + 1;
+    }
+    if (lineEnd > line && *(lineEnd - 1) == '\r')
+    {
+        --lineEnd;
+    }
+}
+
+bool RNAFoldOutputParser::seekRecord(std::string* name)
+{
+    bool found = false;
+    bool header = false;
+    while (!found && _cursor < _end)
+    {
+        const char first = *_cursor;
+        if (first == HEADER_MARK)
+        {
+            const char* line;
+            const char* lineEnd;
+            takeLine(line, lineEnd);
+            if (name != NULL)
+            {
+                name->assign(line + 1, lineEnd);
+            }
+            header = true;
+        }
+        else if (isalpha(static_cast<unsigned char>(first)))
+        {
+            found = true;
+        }
+        else
+        {
+            //not the beginning of a record: extra line of the previous one, or empty line
+            const char* line;
+            const char* lineEnd;
+            takeLine(line, lineEnd);
+        }
+    }
+    if (found && !header && name != NULL)
+    {
+        name->clear();
+    }
+    if (!found && header)
+    {
+        throw RNABackendException("Header without sequence in RNAfold output");
+    }
+    return found;
+}
+
+Fe RNAFoldOutputParser::parseEnergy(const char* from, const char* lineEnd)
+{
+    const char* open = static_cast<const char*>(memchr(from, OPEN_ENERGY, lineEnd - from));
+    if (open == NULL)
+    {
+        throw RNABackendException("Could not read free energy");
+    }
+    ++open;
+    char* number;
+    const Fe energy = strtod(open, &number);
+    const char* close = number;
+    while (close < lineEnd && *close == ' ')
+    {
+        ++close;
+    }
+    if (number == open || close >= lineEnd || *close != CLOSE_ENERGY)
+    {
+        throw RNABackendException("Could not read free energy");
+    }
+    return energy;
+}
+
+void RNAFoldOutputParser::parseRecord(const char*& structure, size_t& length, Fe& energy, std::string* sequence)
+{
+    const char* line;
+    const char* lineEnd;
+    takeLine(line, lineEnd);
+    const char* sequenceEnd = line;
+    while (sequenceEnd < lineEnd && !isspace(static_cast<unsigned char>(*sequenceEnd)))
+    {
+        ++sequenceEnd;
+    }
+    length = sequenceEnd - line;
+    if (sequence != NULL)
+    {
+        sequence->assign(line, sequenceEnd);
+    }
+
+    if (_cursor >= _end)
+    {
+        throw RNABackendException("Missing structure in RNAfold output");
+    }
+    takeLine(line, lineEnd);
+    if (size_t(lineEnd - line) < length)
+    {
+        throw RNABackendException("Structure shorter than sequence in RNAfold output");
+    }
+    structure = line;
+    energy = parseEnergy(line + length, lineEnd);
+}
+
+bool RNAFoldOutputParser::next(RNAFoldRecord& record)
+{
+    const bool ret = seekRecord(&record.name);
+    if (ret)
+    {
+        const char* structure;
+        size_t length;
+        parseRecord(structure, length, record.energy, &record.sequence);
+        record.structure.assign(structure, length);
+    }
+    return ret;
+}
+
+bool RNAFoldOutputParser::nextEnergy(Fe& energy)
+{
+    const bool ret = seekRecord(NULL);
+    if (ret)
+    {
+        const char* structure;
+        size_t length;
+        parseRecord(structure, length, energy, NULL);
+    }
+    return ret;
+}
+
+} //namespace fideo
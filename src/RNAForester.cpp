@@ -27,37 +27,140 @@
 #define _RNAFORESTER_H
 
 #include <sstream>
+#include <fstream>
+#include <algorithm>
+#include <unistd.h>
 #include <etilico/etilico.h>
 #include "fideo/FideoHelper.h"
 #include "fideo/FideoStructureParser.h"
 #include "fideo/IStructureCmp.h"
+#include "fideo/SimilarityMatrix.h"
 
 namespace fideo
 {
 
+static const std::string RNAforester_PROG = "RNAforester";
+
+/**
+ * Temporary files of one RNAforester run. They are unlinked when the
+ * guard is destroyed, so none is left behind if the run throws.
+ */
+class ForesterFiles
+{
+public:
+    ForesterFiles()
+        : files()
+    {}
+
+    ~ForesterFiles()
+    {
+        //maybe unwinding: errors are ignored, as the files may not exist.
+        for (size_t i = 0; i < files.size(); ++i)
+        {
+            unlink(files[i].c_str());
+        }
+    }
+
+    /**
+     * Create a new temporary file.
+     * @return the path of the file.
+     */
+    FilePath create()
+    {
+        const std::string path = "/tmp/";
+        std::string prefix = "fideo-XXXXXX";
+        std::string file;
+        etilico::createTemporaryFile(file, path, prefix);
+        files.push_back(file);
+        return file;
+    }
+
+    /**
+     * Also unlink a file that RNAforester creates by itself.
+     * @param file the path of the file.
+     */
+    void track(const FilePath& file)
+    {
+        files.push_back(file);
+    }
+
+    /**
+     * Unlink all the files, once the run succeeded.
+     */
+    void remove()
+    {
+        for (size_t i = 0; i < files.size(); ++i)
+        {
+            mili::assert_throw<UnlinkException>(unlink(files[i].c_str()) == 0);
+        }
+        files.clear();
+    }
+
+private:
+    std::vector<FilePath> files;
+};
+
 /**
- * Implementation using system call to RNAforester
+ * Implementation using system call to RNAforester, with the relative
+ * score of its pairwise mode (-r).
+ *
+ * compareAll is the default one run per pair: the pairwise mode aligns
+ * the first two structures of its input and exits, so these scores
+ * cannot be batched. RNAForesterProfile batches its own scores.
  */
 class RNAForester : public IStructureCmp
 {
-    static const FilePath IN;
-    static const FilePath OUT;
     static const FileLineNo LINE_NO;
-    static const std::string RNAforester_PROG;
+
     virtual Similitude compare(const biopp::SecStructure&, const biopp::SecStructure&) const;
 };
 
+/**
+ * Implementation using system call to RNAforester, with the scores of
+ * its multiple alignment mode (-m), the ones it uses for clustering.
+ *
+ * These are not the scores of RNAForester, so it has its own name.
+ * A pair gets the same score alone or among other structures, so
+ * compareAll scores all the pairs of up to BATCH_CHUNK structures in
+ * one run, and compare runs the same mode for just the pair.
+ */
+class RNAForesterProfile : public IStructureCmp
+{
+    static const std::string SCORES_MARK;
+    static const std::string CLUSTER_SUFFIX;
+    static const size_t BATCH_CHUNK;
+
+    virtual Similitude compare(const biopp::SecStructure&, const biopp::SecStructure&) const;
+    virtual void compareAll(const std::vector<biopp::SecStructure>& structures, std::vector<Similitude>& upper) const;
+
+    /**
+     * Score all the pairs of some of the structures with one run.
+     * @param structures all the structures.
+     * @param members indexes of the structures to score, increasing.
+     * @param scores to fill with the scores of the members, as in SimilarityMatrix.
+     */
+    static void runBatch(const std::vector<biopp::SecStructure>& structures, const std::vector<size_t>& members, std::vector<Similitude>& scores);
+    static void parseBatch(const FilePath& file, const size_t members, std::vector<Similitude>& scores);
+};
+
 REGISTER_FACTORIZABLE_CLASS(IStructureCmp, RNAForester, std::string, "RNAForester");
+REGISTER_FACTORIZABLE_CLASS(IStructureCmp, RNAForesterProfile, std::string, "RNAForesterProfile");
 
-const FilePath RNAForester::IN = "forester.in";
-const FilePath RNAForester::OUT = "forester.out";
 const FileLineNo RNAForester::LINE_NO = 1;
-const std::string RNAForester::RNAforester_PROG = "RNAforester";
+const std::string RNAForesterProfile::SCORES_MARK = "Computing all pairwise similarities";
+const std::string RNAForesterProfile::CLUSTER_SUFFIX = "_cluster.dot";
+const size_t RNAForesterProfile::BATCH_CHUNK = 256;
 
 Similitude RNAForester::compare(const biopp::SecStructure& struct1, const biopp::SecStructure& struct2) const
 {
+    //files of its own, so concurrent comparators (e.g. the workers of a
+    //SimilarityMatrix) do not overwrite each other.
+    ForesterFiles files;
+    const FilePath inputFile = files.create();
+    const FilePath outputFile = files.create();
+
     std::stringstream ss;
-    ss << RNAforester_PROG << " -r --score -f " << IN << " > " << OUT;
+    ss << RNAforester_PROG << " -r --score -f " << inputFile << " > " << outputFile;
 
     const etilico::Command CMD = ss.str();
 
@@ -70,17 +173,171 @@ Similitude RNAForester::compare(const biopp::SecStructure& struct1, const biopp:
     insert_into(lines, struct1_str);
     insert_into(lines, struct2_str);
 
-    helper::write(IN, lines);
+    helper::write(inputFile, lines);
     etilico::runCommand(CMD);
 
     FileLine aux;
-    helper::readLine(OUT, LINE_NO, aux);
+    helper::readLine(outputFile, LINE_NO, aux);
+    files.remove();
 
     Similitude s;
     helper::readValue(aux, s);
     return s;
 }
 
+Similitude RNAForesterProfile::compare(const biopp::SecStructure& struct1, const biopp::SecStructure& struct2) const
+{
+    std::vector<biopp::SecStructure> pair;
+    pair.push_back(struct1);
+    pair.push_back(struct2);
+    std::vector<size_t> members;
+    members.push_back(0);
+    members.push_back(1);
+    std::vector<Similitude> scores;
+    runBatch(pair, members, scores);
+    return scores[0];
+}
+
+static bool isPrime(const size_t q)
+{
+    if (q < 2)
+        return false;
+    for (size_t d = 2; d * d <= q; ++d)
+    {
+        if (q % d == 0)
+            return false;
+    }
+    return true;
+}
+
+void RNAForesterProfile::compareAll(const std::vector<biopp::SecStructure>& structures, std::vector<Similitude>& upper) const
+{
+    const size_t n = structures.size();
+    upper.assign(SimilarityMatrix::entries(n), Similitude(0));
+    if (n < 2)
+        return;
+    std::vector<size_t> members;
+    if (n <= BATCH_CHUNK)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            members.push_back(i);
+        }
+        runBatch(structures, members, upper);
+        return;
+    }
+
+    //a run aligns all the pairs of its members, so runs must not share
+    //pairs. The structures go in q * q blocks, the points of the affine
+    //plane of prime order q, and each of its q * (q + 1) lines is a run.
+    //Two blocks share exactly one line, so a pair of structures is only
+    //aligned again when both are in the same block: about 1 / q of the
+    //work.
+    size_t q = (n + BATCH_CHUNK - 1) / BATCH_CHUNK;
+    while (!isPrime(q) || (q * ((n + q * q - 1) / (q * q)) > BATCH_CHUNK && q * q < n))
+    {
+        ++q;
+    }
+    const size_t blockSize = (n + q * q - 1) / (q * q);
+    const size_t blocks = (n + blockSize - 1) / blockSize;
+    std::vector<bool> scored(blocks, false);
+    for (size_t line = 0; line < q * (q + 1); ++line)
+    {
+        std::vector<size_t> run;
+        for (size_t x = 0; x < q; ++x)
+        {
+            //block (x, y) is x * q + y; lines y = slope * x + intercept,
+            //then the vertical ones.
+            const size_t block = (line < q * q ? x * q + ((line / q) * x + line % q) % q : (line - q * q) * q + x);
+            if (block < blocks)
+                run.push_back(block);
+        }
+        if (run.size() < 2)
+            continue;
+        std::sort(run.begin(), run.end());
+
+        members.clear();
+        for (size_t r = 0; r < run.size(); ++r)
+        {
+            for (size_t i = run[r] * blockSize; i < std::min(n, (run[r] + 1) * blockSize); ++i)
+            {
+                members.push_back(i);
+            }
+        }
+        std::vector<Similitude> scores;
+        runBatch(structures, members, scores);
+        for (size_t x = 0; x < members.size(); ++x)
+        {
+            const size_t blockX = members[x] / blockSize;
+            for (size_t y = x + 1; y < members.size(); ++y)
+            {
+                const size_t blockY = members[y] / blockSize;
+                if (blockX != blockY || !scored[blockX])
+                    upper[SimilarityMatrix::index(members[x], members[y], n)] = scores[SimilarityMatrix::index(x, y, members.size())];
+            }
+        }
+        for (size_t r = 0; r < run.size(); ++r)
+        {
+            scored[run[r]] = true;
+        }
+    }
+}
+
+void RNAForesterProfile::runBatch(const std::vector<biopp::SecStructure>& structures, const std::vector<size_t>& members, std::vector<Similitude>& scores)
+{
+    ForesterFiles files;
+    const FilePath inputFile = files.create();
+    const FilePath outputFile = files.create();
+    files.track(inputFile + CLUSTER_SUFFIX);
+
+    FileLinesCt lines;
+    for (size_t i = 0; i < members.size(); ++i)
+    {
+        std::string structure;
+        ViennaParser::toString(structures[members[i]], structure);
+        insert_into(lines, structure);
+    }
+    helper::write(inputFile, lines);
+
+    //thresholds above any relative score, so that no clusters are joined.
+    std::stringstream ss;
+    ss << RNAforester_PROG << " -m -mt=2 -mc=2 --score -f " << inputFile << " > " << outputFile;
+    const etilico::Command cmd = ss.str();
+    etilico::runCommand(cmd);
+
+    parseBatch(outputFile, members.size(), scores);
+    files.remove();
+}
+
+void RNAForesterProfile::parseBatch(const FilePath& file, const size_t members, std::vector<Similitude>& scores)
+{
+    std::ifstream in(file.c_str());
+    mili::assert_throw<NotFoundFileException>(in);
+    std::string line;
+    while (std::getline(in, line) && line != SCORES_MARK)
+    {}
+
+    //lines "x,y: score", 1-based and x > y, until an empty line.
+    scores.assign(SimilarityMatrix::entries(members), Similitude(0));
+    size_t found = 0;
+    while (std::getline(in, line) && !line.empty())
+    {
+        std::istringstream fields(line);
+        size_t x;
+        size_t y;
+        char comma;
+        char colon;
+        Similitude score;
+        if (fields >> x >> comma >> y >> colon >> score && comma == ',' && colon == ':' && y < x && x <= members && y > 0)
+        {
+            scores[SimilarityMatrix::index(y - 1, x - 1, members)] = score;
+            ++found;
+        }
+    }
+    if (found != scores.size())
+        throw RNABackendException("Incomplete RNAforester output");
+}
+
 }//end namespace
 
 #endif  /* _RNAFORESTER_H */
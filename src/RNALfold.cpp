@@ -0,0 +1,211 @@
+/*
+ * @file     RNALfold.cpp
+ * @brief    RNALfold/RNAplfold local folding backend.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Source file for fideo providing class RNALfold implementation.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <unistd.h>
+#include <etilico/etilico.h>
+#include "fideo/ILocalFold.h"
+#include "fideo/RnaBackendsException.h"
+
+namespace fideo
+{
+
+/** @brief Local folding using system calls to the Vienna package
+ *
+ * foldLocal runs RNALfold and pairingProbabilities runs RNAplfold, each
+ * once over the whole sequence.
+ */
+class RNALfold : public ILocalFold
+{
+    static const FilePath PATH;
+    static const FileLine UNPAIRED_SUFFIX;
+    static const FileLine PLOT_SUFFIX;
+
+    virtual Fe foldLocal(const biopp::NucSequence& sequence, const size_t span, std::vector<LocalStructure>& structures, const Temperature temp);
+    virtual void pairingProbabilities(const biopp::NucSequence& sequence, const size_t window, const size_t span, std::vector<Probability>& paired, const Temperature temp);
+
+    /** @brief Create a temporary file in PATH
+     *
+     * @param file: to fill with the full path of the file
+     * @return void
+     */
+    static void createTemporary(FilePath& file);
+
+    /** @brief Parse the output of RNALfold
+     *
+     * @param output: whole output of RNALfold
+     * @param structures: to fill with the local structures
+     * @return the free energy of the whole sequence
+     */
+    static Fe parseLocal(const std::string& output, std::vector<LocalStructure>& structures);
+
+    /** @brief Parse the unpaired probabilities written by RNAplfold
+     *
+     * @param output: whole content of the _lunp file
+     * @param paired: to fill with the paired probabilities
+     * @return void
+     */
+    static void parseUnpaired(const std::string& output, std::vector<Probability>& paired);
+};
+
+REGISTER_FACTORIZABLE_CLASS(ILocalFold, RNALfold, std::string, "RNALfold");
+
+const FilePath RNALfold::PATH = "/tmp/";
+const FileLine RNALfold::UNPAIRED_SUFFIX = "_lunp";
+const FileLine RNALfold::PLOT_SUFFIX = "_dp.ps";
+
+/** @brief Order local structures by start */
+static bool startsBefore(const LocalStructure& a, const LocalStructure& b)
+{
+    return a.start < b.start;
+}
+
+void RNALfold::createTemporary(FilePath& file)
+{
+    std::string prefix = "fideo-XXXXXX";
+    etilico::createTemporaryFile(file, PATH, prefix);
+}
+
+Fe RNALfold::foldLocal(const biopp::NucSequence& sequence, const size_t span, std::vector<LocalStructure>& structures, const Temperature temp)
+{
+    FilePath inputFile;
+    FilePath outputFile;
+    createTemporary(inputFile);
+    createTemporary(outputFile);
+    FileLine sseq = sequence.getString();
+    helper::write(inputFile, sseq);
+
+    std::stringstream ss;
+    ss << "RNALfold -L " << span << " -T " << temp;
+    ss << " < " << inputFile << " > " << outputFile;
+    const etilico::Command command = ss.str(); /// RNALfold -L span -T temp < inputFile > outputFile
+    etilico::runCommand(command);
+
+    std::string output;
+    helper::readFile(outputFile, output);
+    mili::assert_throw<UnlinkException>(unlink(inputFile.c_str()) == 0);
+    mili::assert_throw<UnlinkException>(unlink(outputFile.c_str()) == 0);
+    return parseLocal(output, structures);
+}
+
+Fe RNALfold::parseLocal(const std::string& output, std::vector<LocalStructure>& structures)
+{
+    /// one line per structure: "((...)). (-9.30)   25", the start 1-based;
+    /// then the sequence and the energy of the whole sequence: " (-38.90)"
+    structures.clear();
+    const char* line = output.c_str();
+    const char* const end = line + output.size();
+    while (line < end && (*line == '.' || *line == '('))
+    {
+        const char* const blank = strchr(line, ' ');
+        const char* const open = blank == NULL ? NULL : strchr(blank, '(');
+        if (open == NULL)
+        {
+            throw RNABackendException("Invalid RNALfold output");
+        }
+        char* close;
+        LocalStructure local;
+        local.energy = strtod(open + 1, &close);
+        local.start = strtoul(close + 1, NULL, 10) - 1;
+        local.structure.pack(std::string(line, blank));
+        structures.push_back(local);
+        const char* const next = strchr(open, '\n');
+        line = next == NULL ? end : next + 1;
+    }
+    const char* const sequenceEnd = strchr(line, '\n');
+    const char* const total = sequenceEnd == NULL ? NULL : strchr(sequenceEnd, '(');
+    if (total == NULL)
+    {
+        throw RNABackendException("Empty RNALfold output");
+    }
+    /// RNALfold reports the structures from the 3' end
+    std::stable_sort(structures.begin(), structures.end(), startsBefore);
+    return strtod(total + 1, NULL);
+}
+
+void RNALfold::pairingProbabilities(const biopp::NucSequence& sequence, const size_t window, const size_t span, std::vector<Probability>& paired, const Temperature temp)
+{
+    mili::assert_throw<InvalidWindow>(span <= window);
+    FilePath inputFile;
+    createTemporary(inputFile);
+    /// RNAplfold names its outputs after the fasta header, in the working directory
+    const FileLine name = inputFile.substr(PATH.size());
+    FileLinesCt lines;
+    insert_into(lines, ">" + name);
+    insert_into(lines, sequence.getString());
+    helper::write(inputFile, lines);
+
+    std::stringstream ss;
+    ss << "cd " << PATH << " && RNAplfold -W " << window << " -L " << span << " -u 1 -T " << temp;
+    ss << " < " << inputFile << " > /dev/null";
+    const etilico::Command command = ss.str(); /// cd PATH && RNAplfold -W window -L span -u 1 -T temp < inputFile > /dev/null
+    etilico::runCommand(command);
+
+    const FilePath unpairedFile = PATH + name + UNPAIRED_SUFFIX;
+    const FilePath plotFile = PATH + name + PLOT_SUFFIX;
+    std::string output;
+    helper::readFile(unpairedFile, output);
+    mili::assert_throw<UnlinkException>(unlink(inputFile.c_str()) == 0);
+    mili::assert_throw<UnlinkException>(unlink(unpairedFile.c_str()) == 0);
+    mili::assert_throw<UnlinkException>(unlink(plotFile.c_str()) == 0);
+    parseUnpaired(output, paired);
+    if (paired.size() != sequence.length())
+    {
+        throw RNABackendException("Invalid RNAplfold output");
+    }
+}
+
+void RNALfold::parseUnpaired(const std::string& output, std::vector<Probability>& paired)
+{
+    /// comment lines start with '#' or " #", then "i\tp\t" with p the
+    /// probability of position i (1-based) being unpaired
+    paired.clear();
+    const char* line = output.c_str();
+    const char* const end = line + output.size();
+    while (line < end)
+    {
+        char* field;
+        strtoul(line, &field, 10);
+        if (field != line)
+        {
+            paired.push_back(Probability(1) - strtod(field, NULL));
+        }
+        const char* const next = strchr(line, '\n');
+        line = next == NULL ? end : next + 1;
+    }
+}
+
+} //namespace fideo
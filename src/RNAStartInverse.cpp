@@ -23,18 +23,116 @@
  *
  */
 #include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <memory>
+#include <exception>
+#include <atomic>
+#include <cstring>
+#include <stdint.h>
 #include <mili/mili.h>
 #include "fideo/RNAStartInverse.h"
+#include "fideo/ViennaFolder.h"
+#include "fideo/FideoHelper.h"
+#include "fideo/FideoStructureParser.h"
 
 namespace fideo
 {
 
+/**
+ * Layout of the design snapshots, in native byte order:
+ * header, target (size and hash of its dot-bracket), original start,
+ * rank of the next combination and current free positions, designs
+ * found (bases and packed words each) and pending candidates.
+ */
+struct DesignSnapshotFormat
+{
+    struct Header
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t reserved;
+    };
+
+    static const uint32_t VERSION = 1;
+    static const char MAGIC[8];
+};
+
+const char DesignSnapshotFormat::MAGIC[8] = {'F', 'I', 'D', 'E', 'O', 'D', 'S', 'N'};
+
+template <class T>
+static void writeValue(std::ostream& out, const T& value)
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <class T>
+static void readValue(std::istream& in, T& value)
+{
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    mili::assert_throw<InvalidDesignSnapshot>(in);
+}
+
+static void writeString(std::ostream& out, const std::string& str)
+{
+    writeValue(out, uint64_t(str.size()));
+    out.write(str.data(), str.size());
+}
+
+/**
+ * Reads a string written by writeString, of a known length: any other
+ * length means a corrupt snapshot, checked before allocating it.
+ */
+static void readString(std::istream& in, const size_t length, std::string& str)
+{
+    uint64_t size;
+    readValue(in, size);
+    if (size != length)
+        throw InvalidDesignSnapshot("Sequence and target structure must have the same length");
+    str.resize(size);
+    if (size > 0)
+        in.read(&str[0], size);
+    mili::assert_throw<InvalidDesignSnapshot>(in);
+}
+
+static uint64_t structureHash(const biopp::SecStructure& structure)
+{
+    std::string str;
+    ViennaParser::toString(structure, str);
+    return helper::hash64(str.data(), str.size());
+}
+
+/**
+ * Writes each design of a SequenceSet.
+ */
+struct DesignWriter
+{
+    explicit DesignWriter(std::ostream& out)
+        : out(out)
+    {}
+
+    void operator()(const PackedSequence& design)
+    {
+        writeValue(out, uint64_t(design.size()));
+        out.write(reinterpret_cast<const char*>(design.words().data()), design.words().size() * sizeof(uint64_t));
+    }
+
+    std::ostream& out;
+};
+
 RNAStartInverse::RNAStartInverse(const InverseFoldParams& params)
-    : combination_attempts(params.ca),
+    : found(params.ed, params.ed > 0 ? BLOOM_BITS_PER_DESIGN : 0),
+      diverse(params.dd),
+      combination_attempts(params.ca),
+      parallel_attempts(params.pa),
+      verify(params.vf),
       combinator(new SeqIndexesCombinator(params.structure.size(), params.hd)),
+      spent_attempts(0),
       structure(params.structure),
       max_structure_distance(params.sd),
-      max_sequence_distance(params.hd)
+      max_sequence_distance(params.hd),
+      designs_per_run(params.dr)
 {}
 
 RNAStartInverse::~RNAStartInverse()
@@ -45,25 +143,20 @@ RNAStartInverse::~RNAStartInverse()
 void RNAStartInverse::fold_inverse(biopp::NucSequence& sequence, const Temperature temp)
 {
     std::string seq;
-    Distance hd;
-    Similitude sd;
+    //the energy parameters are scaled once for all the candidates.
+    const std::unique_ptr<ViennaFolder> folder(verify ? new ViennaFolder(temp) : NULL);
 
     CombinationAttempts i = combination_attempts;
     bool c;
     do
     {
         --i;
-        do
-        {
-            execute(seq, hd, sd, temp);
-        }
-        while (sd > max_structure_distance);
+        c = !attempt(seq, temp, folder.get());
 
         //If the sequence found was already returned and we reach the number
         //of attempts for the current combination of free positions in 'start',
         //we move to the next combination, change the 'start' and re-start the
         //number of attempts.
-        c = mili::contains(found, seq);
         if (c && i == 0)
         {
             combinator->next(positions);
@@ -74,18 +167,313 @@ void RNAStartInverse::fold_inverse(biopp::NucSequence& sequence, const Temperatu
     while (c);
 
     //Adds the sequence found to the set.
-    mili::insert_into(found, seq);
+    const PackedSequence packed(seq);
+    found.insert(packed);
+    diverse.insert(packed);
     sequence = biopp::NucSequence(seq);
 }
 
+void RNAStartInverse::generate(RunControl& control, Candidates& found, const Temperature temp) const
+{
+    etilico::Command cmd;
+    get_command(cmd, temp);
+    if (control.start(cmd))
+    {
+        parse_output(control.process(), found);
+        control.process().wait();
+    }
+}
+
+void RNAStartInverse::get_command(etilico::Command&, const Temperature) const
+{
+    throw RNABackendException("Backend does not run a command");
+}
+
+void RNAStartInverse::parse_output(ChildProcess&, Candidates&) const
+{
+    throw RNABackendException("Backend does not run a command");
+}
+
+void RNAStartInverse::set_budget(const DesignBudget& newBudget)
+{
+    budget = newBudget;
+    spent_attempts = 0;
+    deadline = std::chrono::steady_clock::now()
+               + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(budget.seconds));
+}
+
+void RNAStartInverse::spend_attempt()
+{
+    size_t spent = spent_attempts;
+    do
+    {
+        if (budget.attempts > 0 && spent >= budget.attempts)
+            throw DesignBudgetExhausted("No attempts left");
+        if (out_of_time())
+            throw DesignBudgetExhausted("No time left");
+    }
+    while (!spent_attempts.compare_exchange_weak(spent, spent + 1));
+}
+
+bool RNAStartInverse::out_of_time() const
+{
+    return budget.seconds > 0 && std::chrono::steady_clock::now() >= deadline;
+}
+
+/**
+ * Control of a run that is only cancelled when the time is over.
+ */
+class RNAStartInverse::SerialRun : public RNAStartInverse::RunControl
+{
+public:
+    SerialRun(const RNAStartInverse& owner, ChildProcess& process)
+        : owner(owner), running(process)
+    {}
+
+    virtual bool start(const etilico::Command& cmd)
+    {
+        running.start(cmd);
+        return true;
+    }
+
+    virtual ChildProcess& process()
+    {
+        return running;
+    }
+
+    virtual bool cancelled() const
+    {
+        return owner.out_of_time();
+    }
+
+private:
+    const RNAStartInverse& owner;
+    ChildProcess& running;
+};
+
+void RNAStartInverse::execute(ChildProcess& process, const Temperature temp)
+{
+    SerialRun control(*this, process);
+    generate(control, candidates, temp);
+}
+
+bool RNAStartInverse::attempt(std::string& seq, const Temperature temp, ViennaFolder* folder)
+{
+    ChildProcess process;
+    while (true)
+    {
+        while (!candidates.empty())
+        {
+            const Candidate candidate = candidates.front();
+            candidates.pop_front();
+            if (candidate.sd <= max_structure_distance)
+            {
+                seq = candidate.seq;
+                if (!is_novel(seq))
+                    return false;
+                //the ones missing the target at this temperature are dropped.
+                if (is_verified(seq, folder))
+                    return true;
+            }
+        }
+        if (parallel_attempts > 1)
+        {
+            //each run pays its own attempt; when no run wins, the
+            //candidates they found are buffered.
+            if (parallel_attempt(seq, temp))
+                return true;
+        }
+        else
+        {
+            spend_attempt();
+            execute(process, temp);
+        }
+    }
+}
+
+/**
+ * Shared state of the runs launched for one attempt.
+ * Processes are only started while holding the lock and after checking
+ * the cancel flag, so cancel() never misses a run.
+ */
+class RNAStartInverse::ParallelAttempt
+{
+public:
+    ParallelAttempt(RNAStartInverse& owner, const size_t runs, const Temperature temp)
+        : owner(owner), processes(runs), temp(temp), cancelled(false), found(false)
+    {
+        for (size_t i = 0; i < runs; ++i)
+        {
+            processes[i].reset(new ChildProcess);
+        }
+    }
+
+    /**
+     * Control of one of the runs; the process is started holding the lock.
+     */
+    class Run : public RunControl
+    {
+    public:
+        Run(ParallelAttempt& shared, ChildProcess& process)
+            : shared(shared), running(process)
+        {}
+
+        virtual bool start(const etilico::Command& cmd)
+        {
+            std::lock_guard<std::mutex> guard(shared.lock);
+            if (shared.cancelled)
+            {
+                return false;
+            }
+            running.start(cmd);
+            return true;
+        }
+
+        virtual ChildProcess& process()
+        {
+            return running;
+        }
+
+        virtual bool cancelled() const
+        {
+            return shared.cancelled || shared.owner.out_of_time();
+        }
+
+    private:
+        ParallelAttempt& shared;
+        ChildProcess& running;
+    };
+
+    void run(const size_t index)
+    {
+        Run control(*this, *processes[index]);
+        //each thread verifies with its own folder, see ViennaFolder.
+        const std::unique_ptr<ViennaFolder> folder(owner.verify ? new ViennaFolder(temp) : NULL);
+        Candidates local;
+        bool valid = false;
+        try
+        {
+            do
+            {
+                local.clear();
+                owner.spend_attempt();
+                owner.generate(control, local, temp);
+                if (cancelled || owner.out_of_time())
+                {
+                    return;
+                }
+                for (Candidates::const_iterator it = local.begin(); it != local.end() && !valid; ++it)
+                {
+                    valid = it->sd <= owner.max_structure_distance;
+                }
+            }
+            while (!valid);
+        }
+        catch (const DesignBudgetExhausted&)
+        {
+            //the other runs finish the attempts they already paid.
+            std::lock_guard<std::mutex> guard(lock);
+            exhausted = std::current_exception();
+            return;
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if (!cancelled)
+            {
+                error = std::current_exception();
+                cancel();
+            }
+            return;
+        }
+
+        //the designs of the owner are not modified while the runs are alive.
+        Candidates::iterator it = local.begin();
+        while (it != local.end() && (it->sd > owner.max_structure_distance || !owner.is_novel(it->seq) || !owner.is_verified(it->seq, folder.get())))
+        {
+            ++it;
+        }
+        //the ones already rejected would fail again at this temperature.
+        local.erase(local.begin(), it);
+        std::lock_guard<std::mutex> guard(lock);
+        if (it != local.end() && !cancelled)
+        {
+            winner = it->seq;
+            found = true;
+            local.erase(it);
+            cancel();
+        }
+        spare.splice(spare.end(), local);
+    }
+
+    RNAStartInverse& owner;
+    std::vector<std::unique_ptr<ChildProcess> > processes;
+    const Temperature temp;
+    std::mutex lock;
+    std::atomic<bool> cancelled;
+    bool found;
+    std::string winner;
+    Candidates spare;
+    std::exception_ptr error;
+    std::exception_ptr exhausted;
+
+private:
+
+    /** Must be called holding the lock. */
+    void cancel()
+    {
+        cancelled = true;
+        for (size_t i = 0; i < processes.size(); ++i)
+        {
+            processes[i]->kill();
+        }
+    }
+};
+
+bool RNAStartInverse::parallel_attempt(std::string& seq, const Temperature temp)
+{
+    ParallelAttempt shared(*this, parallel_attempts, temp);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < parallel_attempts; ++i)
+    {
+        threads.push_back(std::thread(&ParallelAttempt::run, &shared, i));
+    }
+    for (size_t i = 0; i < threads.size(); ++i)
+    {
+        threads[i].join();
+    }
+    if (shared.error)
+    {
+        std::rethrow_exception(shared.error);
+    }
+    candidates.splice(candidates.end(), shared.spare);
+    if (shared.found)
+    {
+        seq = shared.winner;
+    }
+    else if (shared.exhausted && candidates.empty())
+    {
+        std::rethrow_exception(shared.exhausted);
+    }
+    return shared.found;
+}
+
 void RNAStartInverse::set_start(const biopp::NucSequence& sequence)
 {
     if (sequence.length() < max_sequence_distance)
         throw RNABackendException("Start sequence must have at least 'max_sequence_distance' length");
+    //the start and the designs are kept packed, two bits per base.
+    for (size_t i = 0; i < sequence.length(); ++i)
+    {
+        if (strchr("acgtu", tolower(sequence[i].as_char())) == NULL)
+            throw UnsupportedException("Start sequence must only have A, C, G and U (or T) bases");
+    }
 
-    //clear any previous start and found set.
+    //clear any previous start, designs and buffered candidates.
     start.clear();
     found.clear();
+    diverse.clear();
+    candidates.clear();
     //Sets the start in lowercase. We need this to avoid that RNAinverse
     //make changes everywhere.
     for (size_t i = 0; i < sequence.length(); ++i)
@@ -93,7 +481,7 @@ void RNAStartInverse::set_start(const biopp::NucSequence& sequence)
         start += tolower(sequence[i].as_char());
     }
     //Adds the start to the set of found sequences.
-    mili::insert_into(found, start);
+    found.insert(start);
 
     //rembember the original start.
     rstart = start;
@@ -104,8 +492,136 @@ void RNAStartInverse::set_start(const biopp::NucSequence& sequence)
     change_start();
 }
 
+void RNAStartInverse::save_state(std::ostream& out) const
+{
+    DesignSnapshotFormat::Header header;
+    memcpy(header.magic, DesignSnapshotFormat::MAGIC, sizeof(header.magic));
+    header.version = DesignSnapshotFormat::VERSION;
+    header.reserved = 0;
+    writeValue(out, header);
+
+    writeValue(out, uint64_t(structure.size()));
+    writeValue(out, structureHash(structure));
+    writeString(out, rstart);
+
+    writeValue(out, uint64_t(combinator->position()));
+    writeValue(out, uint64_t(positions.size()));
+    for (size_t i = 0; i < positions.size(); ++i)
+        writeValue(out, uint64_t(positions[i]));
+
+    writeValue(out, uint64_t(found.size()));
+    DesignWriter writer(out);
+    found.forEach(writer);
+
+    writeValue(out, uint64_t(candidates.size()));
+    for (Candidates::const_iterator it = candidates.begin(); it != candidates.end(); ++it)
+    {
+        writeString(out, it->seq);
+        writeValue(out, it->hd);
+        writeValue(out, it->sd);
+    }
+    mili::assert_throw<InvalidDesignSnapshot>(out);
+}
+
+void RNAStartInverse::load_state(std::istream& in)
+{
+    DesignSnapshotFormat::Header header;
+    readValue(in, header);
+    mili::assert_throw<InvalidDesignSnapshot>(memcmp(header.magic, DesignSnapshotFormat::MAGIC, sizeof(header.magic)) == 0
+            && header.version == DesignSnapshotFormat::VERSION);
+
+    uint64_t size;
+    uint64_t hash;
+    readValue(in, size);
+    readValue(in, hash);
+    if (size != structure.size() || hash != structureHash(structure))
+        throw InvalidDesignSnapshot("Snapshot of another target structure");
+    std::string original;
+    readString(in, structure.size(), original);
+
+    uint64_t rank;
+    uint64_t freeCount;
+    readValue(in, rank);
+    readValue(in, freeCount);
+    if (freeCount != max_sequence_distance)
+        throw InvalidDesignSnapshot("Snapshot with another amount of free positions");
+    SeqIndexesCombination current(freeCount);
+    for (size_t i = 0; i < current.size(); ++i)
+    {
+        uint64_t index;
+        readValue(in, index);
+        mili::assert_throw<InvalidDesignSnapshot>(index < structure.size());
+        current[i] = biopp::SeqIndex(index);
+    }
+
+    //the state is only changed once the whole snapshot was read.
+    std::vector<PackedSequence> designs;
+    uint64_t count;
+    readValue(in, count);
+    PackedSequence design;
+    std::vector<uint64_t> words;
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        uint64_t bases;
+        readValue(in, bases);
+        mili::assert_throw<InvalidDesignSnapshot>(bases == structure.size());
+        words.resize(PackedSequence::wordsFor(bases));
+        in.read(reinterpret_cast<char*>(words.data()), words.size() * sizeof(uint64_t));
+        mili::assert_throw<InvalidDesignSnapshot>(in);
+        design.assign(words.data(), bases);
+        designs.push_back(design);
+    }
+
+    Candidates pending;
+    readValue(in, count);
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        Candidate candidate;
+        readString(in, structure.size(), candidate.seq);
+        readValue(in, candidate.hd);
+        readValue(in, candidate.sd);
+        pending.push_back(candidate);
+    }
+
+    try
+    {
+        combinator->seek(rank);
+    }
+    catch (const CombinatorException&)
+    {
+        throw InvalidDesignSnapshot("Combination out of range");
+    }
+    rstart = original;
+    found.clear();
+    diverse.clear();
+    //the start is in the found set, but it is not a design to keep apart from.
+    const PackedSequence packedStart(rstart);
+    for (size_t i = 0; i < designs.size(); ++i)
+    {
+        found.insert(designs[i]);
+        if (!(designs[i] == packedStart))
+            diverse.insert(designs[i]);
+    }
+    positions.swap(current);
+    change_start();
+    candidates.swap(pending);
+}
+
+bool RNAStartInverse::is_novel(const std::string& seq) const
+{
+    const PackedSequence packed(seq);
+    return !found.contains(packed) && diverse.admits(packed);
+}
+
+bool RNAStartInverse::is_verified(const std::string& seq, ViennaFolder* folder) const
+{
+    return folder == NULL || folder->distance(seq, structure) <= max_structure_distance;
+}
+
 void RNAStartInverse::change_start()
 {
+    //The buffered candidates were designed from the previous start.
+    candidates.clear();
     //Gets the original start
     start = rstart;
     mili::CAutonomousIterator<SeqIndexesCombination> it(positions);
@@ -0,0 +1,141 @@
+/*
+ * @file     RNAsubopt.cpp
+ * @brief    RNAsubopt suboptimal enumeration backend.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Source file for fideo providing class RNAsubopt implementation.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <cstdlib>
+#include <sstream>
+#include "fideo/ISuboptimalFold.h"
+#include "fideo/ChildProcess.h"
+#include "fideo/FideoHelper.h"
+
+namespace fideo
+{
+
+/** @brief Suboptimal enumeration reading RNAsubopt while it runs
+ *
+ * RNAsubopt is run without sorting (-s), which would hold back the
+ * output until the whole band is enumerated.
+ */
+class RNAsubopt : public ISuboptimalFold
+{
+public:
+    RNAsubopt();
+
+private:
+    virtual Fe start(const biopp::NucSequence& sequence, const bool isCirc, const Fe range, const size_t maxCount, const Temperature temp);
+    virtual bool next(Suboptimal& suboptimal);
+    virtual void stop();
+
+    ChildProcess process;
+    size_t remaining;   ///< structures left to read, 0 for no limit.
+    FileLine line;
+};
+
+REGISTER_FACTORIZABLE_CLASS(ISuboptimalFold, RNAsubopt, std::string, "RNAsubopt");
+
+RNAsubopt::RNAsubopt()
+    : process(), remaining(0), line()
+{}
+
+Fe RNAsubopt::start(const biopp::NucSequence& sequence, const bool isCirc, const Fe range, const size_t maxCount, const Temperature temp)
+{
+    stop();
+    std::stringstream ss;
+    //The input goes through a pipe, so concurrent runs share no file.
+    ss << "printf '%s\\n' '" << sequence.getString() << "' | RNAsubopt -e " << range << " --temp=" << temp;
+    if (isCirc)
+    {
+        ss << " --circ";
+    }
+    //cmd looks like "printf '%s\n' 'sequence' | RNAsubopt -e range --temp=temp [--circ]"
+    process.start(ss.str());
+    remaining = maxCount;
+
+    //first line: the sequence, the MFE and the range, both in dcal/mol
+    if (!process.readLine(line))
+    {
+        stop();
+        throw RNABackendException("Could not read RNAsubopt output");
+    }
+    const size_t blank = line.find(' ');
+    char* end = NULL;
+    const long minimum = blank == FileLine::npos ? 0 : strtol(line.c_str() + blank, &end, 10);
+    if (end == NULL || end == line.c_str() + blank)
+    {
+        stop();
+        throw RNABackendException("Invalid RNAsubopt output");
+    }
+    return Fe(minimum) / 100;
+}
+
+bool RNAsubopt::next(Suboptimal& suboptimal)
+{
+    if (!process.running())
+    {
+        return false;
+    }
+    //one line per structure: "((...)).. -18.80"
+    if (!process.readLine(line))
+    {
+        const int status = process.wait();
+        if (status != 0)
+        {
+            throw RNABackendException("RNAsubopt failed");
+        }
+        return false;
+    }
+    const size_t blank = line.find(' ');
+    if (blank == FileLine::npos)
+    {
+        stop();
+        throw RNABackendException("Invalid RNAsubopt output");
+    }
+    suboptimal.structure.pack(line.substr(0, blank));
+    suboptimal.energy = strtod(line.c_str() + blank, NULL);
+    if (remaining > 0 && --remaining == 0)
+    {
+        stop();
+    }
+    return true;
+}
+
+void RNAsubopt::stop()
+{
+    if (process.running())
+    {
+        process.kill();
+        process.wait();
+    }
+}
+
+} //namespace fideo
@@ -0,0 +1,204 @@
+/*
+ * @file     SequenceSet.cpp
+ * @brief    Provides a compact hashed set of nucleotide sequences.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Source file for fideo providing class SequenceSet.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#include "fideo/SequenceSet.h"
+#include "fideo/FideoHelper.h"
+
+namespace fideo
+{
+
+static const uint64_t EMPTY = 0;
+
+SequenceSet::SequenceSet(const size_t expected, const size_t bloomBitsPerSequence)
+    : _arena(),
+      _slots(),
+      _size(0),
+      _bloom(),
+      _bloomBits(0)
+{
+    size_t slots = INITIAL_SLOTS;
+    while (slots < 2 * expected)
+    {
+        slots *= 2;
+    }
+    _slots.assign(slots, EMPTY);
+    if (bloomBitsPerSequence > 0)
+    {
+        const size_t bits = bloomBitsPerSequence * (expected > 0 ? expected : INITIAL_SLOTS);
+        _bloom.assign((bits + 63) / 64, 0);
+        _bloomBits = _bloom.size() * 64;
+    }
+}
+
+bool SequenceSet::insert(const std::string& sequence)
+{
+    return insert(PackedSequence(sequence));
+}
+
+bool SequenceSet::contains(const std::string& sequence) const
+{
+    return contains(PackedSequence(sequence));
+}
+
+bool SequenceSet::insert(const PackedSequence& sequence)
+{
+    const uint64_t hash = sequence.hash();
+    size_t slot;
+    if (find(sequence, hash, slot))
+    {
+        return false;
+    }
+    const uint64_t offset = _arena.size();
+    _arena.push_back(sequence.size());
+    _arena.insert(_arena.end(), sequence.words().begin(), sequence.words().end());
+    _slots[slot] = offset + 1;
+    ++_size;
+    if (_bloomBits > 0)
+    {
+        bloomAdd(hash);
+    }
+    //keep the load factor at most 1/2
+    if (2 * _size > _slots.size())
+    {
+        grow();
+    }
+    return true;
+}
+
+bool SequenceSet::contains(const PackedSequence& sequence) const
+{
+    const uint64_t hash = sequence.hash();
+    if (_bloomBits > 0 && !bloomMayContain(hash))
+    {
+        return false;
+    }
+    size_t slot;
+    return find(sequence, hash, slot);
+}
+
+void SequenceSet::clear()
+{
+    _arena.clear();
+    _slots.assign(_slots.size(), EMPTY);
+    _size = 0;
+    _bloom.assign(_bloom.size(), 0);
+}
+
+bool SequenceSet::find(const PackedSequence& sequence, const uint64_t hash, size_t& slot) const
+{
+    //linear probing; the table size is a power of two.
+    const size_t mask = _slots.size() - 1;
+    slot = size_t(hash) & mask;
+    while (_slots[slot] != EMPTY)
+    {
+        if (equals(_slots[slot] - 1, sequence))
+        {
+            return true;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return false;
+}
+
+bool SequenceSet::equals(const uint64_t offset, const PackedSequence& sequence) const
+{
+    if (_arena[offset] != sequence.size())
+    {
+        return false;
+    }
+    const PackedSequence::Words& words = sequence.words();
+    for (size_t i = 0; i < words.size(); ++i)
+    {
+        if (_arena[offset + 1 + i] != words[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint64_t SequenceSet::hashAt(const uint64_t offset) const
+{
+    PackedSequence sequence;
+    sequence.assign(&_arena[offset + 1], size_t(_arena[offset]));
+    return sequence.hash();
+}
+
+void SequenceSet::grow()
+{
+    Words old;
+    old.swap(_slots);
+    _slots.assign(old.size() * 2, EMPTY);
+    const size_t mask = _slots.size() - 1;
+    for (size_t i = 0; i < old.size(); ++i)
+    {
+        if (old[i] != EMPTY)
+        {
+            size_t slot = size_t(hashAt(old[i] - 1)) & mask;
+            while (_slots[slot] != EMPTY)
+            {
+                slot = (slot + 1) & mask;
+            }
+            _slots[slot] = old[i];
+        }
+    }
+}
+
+/** Double hashing: the i-th probe is h1 + i * h2. */
+void SequenceSet::bloomAdd(const uint64_t hash)
+{
+    const uint64_t h2 = (hash >> 32) | 1;
+    for (size_t i = 0; i < BLOOM_HASHES; ++i)
+    {
+        const uint64_t bit = (hash + i * h2) % _bloomBits;
+        _bloom[bit / 64] |= uint64_t(1) << (bit % 64);
+    }
+}
+
+bool SequenceSet::bloomMayContain(const uint64_t hash) const
+{
+    const uint64_t h2 = (hash >> 32) | 1;
+    for (size_t i = 0; i < BLOOM_HASHES; ++i)
+    {
+        const uint64_t bit = (hash + i * h2) % _bloomBits;
+        if ((_bloom[bit / 64] & (uint64_t(1) << (bit % 64))) == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} //namespace fideo
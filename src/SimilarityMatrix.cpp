@@ -0,0 +1,194 @@
+/*
+ * @file     SimilarityMatrix.cpp
+ * @brief    All-vs-all structure similarity matrix.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Implementation of class SimilarityMatrix.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#include <atomic>
+#include <utility>
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <exception>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "fideo/SimilarityMatrix.h"
+#include "fideo/IStructureCmp.h"
+#include "fideo/RnaBackendsException.h"
+
+namespace fideo
+{
+
+/**
+ * The tiles of one computation. Tiles on the diagonal only
+ * compare the pairs above it. The first failure of a worker
+ * stops the others and is thrown back by compute.
+ */
+class SimilarityMatrix::Tiles
+{
+public:
+    Tiles(const std::vector<biopp::SecStructure>& structures, Similitude* upper, const size_t tileSize)
+        : structures(structures), upper(upper), tileSize(tileSize), next(0), failed(false)
+    {
+        const size_t side = (structures.size() + tileSize - 1) / tileSize;
+        for (size_t row = 0; row < side; ++row)
+        {
+            for (size_t column = row; column < side; ++column)
+            {
+                tiles.push_back(Tile(row, column));
+            }
+        }
+    }
+
+    void work(const IStructureCmp& cmp)
+    {
+        try
+        {
+            size_t tile;
+            while (!failed && (tile = next++) < tiles.size())
+            {
+                fillTile(cmp, tiles[tile].first, tiles[tile].second);
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> guard(errorLock);
+            if (!failed)
+            {
+                error = std::current_exception();
+                failed = true;
+            }
+        }
+    }
+
+    void rethrow() const
+    {
+        if (failed)
+            std::rethrow_exception(error);
+    }
+
+private:
+    typedef std::pair<size_t, size_t> Tile;
+
+    void fillTile(const IStructureCmp& cmp, const size_t tileRow, const size_t tileColumn)
+    {
+        const size_t n = structures.size();
+        const size_t rowEnd = std::min(n, (tileRow + 1) * tileSize);
+        const size_t columnEnd = std::min(n, (tileColumn + 1) * tileSize);
+        for (size_t i = tileRow * tileSize; i < rowEnd; ++i)
+        {
+            const size_t first = std::max(i + 1, tileColumn * tileSize);
+            Similitude* const row = upper + (first < columnEnd ? index(i, first, n) : 0);
+            for (size_t j = first; j < columnEnd; ++j)
+            {
+                row[j - first] = cmp.compare(structures[i], structures[j]);
+            }
+        }
+    }
+
+    const std::vector<biopp::SecStructure>& structures;
+    Similitude* const upper;
+    const size_t tileSize;
+    std::vector<Tile> tiles;
+    std::atomic<size_t> next;
+    std::atomic<bool> failed;
+    std::mutex errorLock;
+    std::exception_ptr error;
+};
+
+SimilarityMatrix::SimilarityMatrix(const std::string& comparator, const size_t workers, const size_t tileSize)
+    : comparator(comparator), workers(workers), tileSize(tileSize)
+{
+    mili::assert_throw<RNABackendException>(workers > 0 && tileSize > 0);
+}
+
+void SimilarityMatrix::fill(const std::vector<biopp::SecStructure>& structures, Similitude* upper) const
+{
+    //comparators may keep buffers between calls, so each worker has one.
+    std::vector<std::unique_ptr<IStructureCmp> > comparators;
+    for (size_t i = 0; i < workers; ++i)
+    {
+        comparators.push_back(std::unique_ptr<IStructureCmp>(IStructureCmp::Factory::new_class(comparator)));
+        mili::assert_throw<InvalidDerived>(comparators.back().get() != NULL);
+    }
+    Tiles tiles(structures, upper, tileSize);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < workers; ++i)
+    {
+        threads.push_back(std::thread(&Tiles::work, &tiles, std::cref(*comparators[i])));
+    }
+    for (size_t i = 0; i < threads.size(); ++i)
+    {
+        threads[i].join();
+    }
+    tiles.rethrow();
+}
+
+void SimilarityMatrix::compute(const std::vector<biopp::SecStructure>& structures, std::vector<Similitude>& upper) const
+{
+    upper.resize(entries(structures.size()));
+    fill(structures, upper.data());
+}
+
+void SimilarityMatrix::compute(const std::vector<biopp::SecStructure>& structures, const FilePath& path) const
+{
+    const size_t size = entries(structures.size()) * sizeof(Similitude);
+    const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    mili::assert_throw<NotFoundFileException>(fd >= 0);
+    if (size == 0)
+    {
+        close(fd);
+        return;
+    }
+    void* address = MAP_FAILED;
+    if (ftruncate(fd, off_t(size)) == 0)
+    {
+        address = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (address == MAP_FAILED)
+        throw RNABackendException("Could not map " + path);
+    try
+    {
+        fill(structures, static_cast<Similitude*>(address));
+    }
+    catch (...)
+    {
+        munmap(address, size);
+        throw;
+    }
+    munmap(address, size);
+}
+
+} //namespace fideo
@@ -0,0 +1,293 @@
+/*
+ * @file     TreeAlignment.cpp
+ * @brief    In-process structure comparison by forest alignment.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Implementation of class TreeAlignment.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <vector>
+#include <climits>
+#include <algorithm>
+#include <biopp/biopp.h>
+#include "fideo/IStructureCmp.h"
+#include "fideo/RnaBackendsException.h"
+
+namespace fideo
+{
+
+/**
+ * Relative score of the global alignment of the forest representations
+ * of two structures, as given by "RNAforester -r --score", computed
+ * without launching a process.
+ *
+ * A base pair is a P node whose children are its left base, the
+ * structure it encloses and its right base; unpaired bases are leaves.
+ * The scores are the ones of RNAforester: pair match 10, pair indel -5,
+ * base match 1, base mismatch 0 and base indel -10. All the bases have
+ * the same label, since only structures are compared.
+ *
+ * The buffers of the forests and of the dynamic programming matrix are
+ * kept between calls, so an instance must not be shared between threads.
+ */
+class TreeAlignment : public IStructureCmp
+{
+    typedef int Score;
+
+    static const Score PAIR_MATCH = 10;
+    static const Score PAIR_INDEL = -5;
+    static const Score BASE_MATCH = 1;
+    static const Score BASE_INDEL = -10;
+    static const Score FORBIDDEN = INT_MIN / 4;
+
+    /**
+     * Preorder forest, with closed subforests (a node and some of its
+     * right brothers) numbered from 1; 0 is the empty forest.
+     */
+    struct Forest
+    {
+        std::vector<char> pair;     //is a P node.
+        std::vector<size_t> rb;     //right brother, 0 if none.
+        std::vector<size_t> noc;    //number of children.
+        std::vector<size_t> sumUp;  //first csf index of each node.
+        std::vector<size_t> rmb;    //rightmost brother.
+        size_t pairs;
+
+        void build(const biopp::SecStructure& structure);
+
+        size_t size() const
+        {
+            return pair.size();
+        }
+
+        size_t maxLength(const size_t i) const
+        {
+            return size() == 1 ? 1 : sumUp[i + 1] - sumUp[i];
+        }
+
+        size_t csfs() const
+        {
+            return sumUp[size()];
+        }
+
+        size_t index(const size_t i, const size_t j) const
+        {
+            return j == 0 ? 0 : sumUp[i] + j - 1;
+        }
+
+        size_t down(const size_t i) const
+        {
+            return index(i + 1, noc[i]);
+        }
+
+        size_t over(const size_t i, const size_t j) const
+        {
+            return index(rb[i], j - 1);
+        }
+
+        //the children of a P node without its bases.
+        size_t mdown(const size_t i) const
+        {
+            return noc[i] <= 2 ? 0 : index(i + 2, noc[i] - 2);
+        }
+
+        //score of aligning the forest with itself.
+        Score maxScore() const
+        {
+            return Score(pairs) * PAIR_MATCH + Score(size() - 3 * pairs) * BASE_MATCH;
+        }
+    };
+
+    mutable Forest fx;
+    mutable Forest fy;
+    mutable std::vector<Score> matrix;
+
+    Score align() const;
+
+    Score at(const size_t x, const size_t y) const
+    {
+        return matrix[x * fy.csfs() + y];
+    }
+
+    virtual Similitude compare(const biopp::SecStructure&, const biopp::SecStructure&) const;
+};
+
+REGISTER_FACTORIZABLE_CLASS(IStructureCmp, TreeAlignment, std::string, "TreeAlignment");
+
+void TreeAlignment::Forest::build(const biopp::SecStructure& structure)
+{
+    const size_t length = structure.size();
+    pairs = 0;
+    for (biopp::SeqIndex p = 0; p < length; ++p)
+    {
+        if (structure.is_paired(p) && structure.paired_with(p) > p)
+            ++pairs;
+    }
+    const size_t nodes = length + pairs;
+    pair.assign(nodes, false);
+    rb.assign(nodes, 0);
+    noc.assign(nodes, 0);
+
+    std::vector<size_t> opened;     //P nodes not closed yet.
+    std::vector<size_t> children(1, 0);
+    size_t node = 0;
+    for (biopp::SeqIndex p = 0; p < length; ++p)
+    {
+        if (!structure.is_paired(p))
+        {
+            rb[node] = (node == nodes - 1) ? 0 : node + 1;
+            ++children.back();
+            ++node;
+        }
+        else if (structure.paired_with(p) > p)
+        {
+            pair[node] = true;
+            ++children.back();
+            opened.push_back(node);
+            children.push_back(1);
+            ++node;
+            //the left base
+            rb[node] = node + 1;
+            ++node;
+        }
+        else
+        {
+            if (opened.empty())
+                throw InvalidStructureException("Unexpected closing pair");
+            //the right base is the last child of the P node.
+            rb[node] = 0;
+            rb[opened.back()] = (node == nodes - 1) ? 0 : node + 1;
+            noc[opened.back()] = children.back() + 1;
+            opened.pop_back();
+            children.pop_back();
+            ++node;
+        }
+    }
+
+    std::vector<size_t> brothers(nodes, 0);
+    rmb.resize(nodes);
+    for (size_t i = nodes; i-- > 0;)
+    {
+        brothers[i] = rb[i] ? brothers[rb[i]] + 1 : 0;
+        rmb[i] = rb[i] ? rmb[rb[i]] : i;
+    }
+    sumUp.resize(nodes + 1);
+    sumUp[0] = 1;
+    for (size_t i = 1; i < nodes; ++i)
+    {
+        sumUp[i] = sumUp[i - 1] + brothers[i - 1] + 1;
+    }
+    sumUp[nodes] = sumUp[nodes - 1] + 1;
+}
+
+TreeAlignment::Score TreeAlignment::align() const
+{
+    const size_t m = fx.size();
+    const size_t n = fy.size();
+    const size_t cols = fy.csfs();
+    matrix.assign(fx.csfs() * cols, 0);
+
+    //align each forest to the empty one.
+    for (size_t i = m; i-- > 0;)
+    {
+        const Score indel = fx.pair[i] ? PAIR_INDEL : BASE_INDEL;
+        for (size_t j = 1; j <= fx.maxLength(i); ++j)
+        {
+            matrix[fx.index(i, j) * cols] = indel + at(fx.down(i), 0) + at(fx.over(i, j), 0);
+        }
+    }
+    for (size_t k = n; k-- > 0;)
+    {
+        const Score indel = fy.pair[k] ? PAIR_INDEL : BASE_INDEL;
+        for (size_t l = 1; l <= fy.maxLength(k); ++l)
+        {
+            matrix[fy.index(k, l)] = indel + at(0, fy.down(k)) + at(0, fy.over(k, l));
+        }
+    }
+
+    for (size_t i = m; i-- > 0;)
+    {
+        const Score deletion = fx.pair[i] ? PAIR_INDEL : BASE_INDEL;
+        const Score* const downRow = &matrix[fx.down(i) * cols];
+        for (size_t k = n; k-- > 0;)
+        {
+            const Score insertion = fy.pair[k] ? PAIR_INDEL : BASE_INDEL;
+            const size_t downCol = fy.down(k);
+            for (size_t j = 1; j <= fx.maxLength(i); ++j)
+            {
+                const Score* const overRow = &matrix[fx.over(i, j) * cols];
+                Score* const row = &matrix[fx.index(i, j) * cols];
+                for (size_t l = 1; l <= fy.maxLength(k); ++l)
+                {
+                    const size_t overCol = fy.over(k, l);
+                    Score score;
+                    if (fx.pair[i] && fy.pair[k])
+                        score = PAIR_MATCH + at(fx.mdown(i), fy.mdown(k)) + overRow[overCol];
+                    else if (fx.pair[i] || fy.pair[k])
+                        score = FORBIDDEN;
+                    else
+                        score = BASE_MATCH + overRow[overCol];
+
+                    //delete i, splitting the forest of k. The children of a
+                    //base are empty, and giving them trees is never better
+                    //than inserting those trees in front of the rest.
+                    const size_t lSplits = fx.pair[i] ? l : 0;
+                    size_t h = k;
+                    for (size_t r = 0; r <= lSplits; ++r)
+                    {
+                        score = std::max(score, deletion + downRow[fy.index(k, r)] + overRow[fy.index(h, l - r)]);
+                        h = fy.rb[h];
+                    }
+                    //insert k, splitting the forest of i.
+                    const size_t jSplits = fy.pair[k] ? j : 0;
+                    h = i;
+                    for (size_t r = 0; r <= jSplits; ++r)
+                    {
+                        score = std::max(score, insertion + at(fx.index(i, r), downCol) + at(fx.index(h, j - r), overCol));
+                        h = fx.rb[h];
+                    }
+                    row[fy.index(k, l)] = score;
+                }
+            }
+        }
+    }
+    return at(fx.index(0, fx.maxLength(0)), fy.index(0, fy.maxLength(0)));
+}
+
+Similitude TreeAlignment::compare(const biopp::SecStructure& struct1, const biopp::SecStructure& struct2) const
+{
+    if (struct1.size() == 0 || struct2.size() == 0)
+        throw InvalidStructureException("Empty structure");
+    fx.build(struct1);
+    fy.build(struct2);
+    const Score optimum = align();
+    return Similitude(2.0 * optimum / double(fx.maxScore() + fy.maxScore()));
+}
+
+} //end namespace fideo
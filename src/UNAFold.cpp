@@ -90,6 +90,9 @@ bool UNAFold::BodyLineParser::parse(File& file)
 REGISTER_FACTORIZABLE_CLASS(IFold, UNAFold, std::string, "UNAFold");
 
 static const std::string PATH_TMP = "/tmp/";
+static const char UNPAIRED = '.';
+static const char OPEN_PAIR = '(';
+static const char CLOSE_PAIR = ')';
 
 void UNAFold::fillStructure(const BodyLineParser& bodyLine, biopp::SecStructure& secStructure)
 {
@@ -178,6 +181,63 @@ void UNAFold::deleteAllFilesAfterProcessing(const InputFile& inFile, const Outpu
     mili::assert_throw<UnlinkException>(unlink(outFile.c_str()) == 0); //.ct file
 }
 
+void UNAFold::processingRawResult(const InputFile& inputFile, PackedStructure& structure, Fe& freeEnergy)
+{
+    File fileIn(inputFile.c_str());
+    mili::assert_throw<NotFoundFileException>(fileIn);
+    HeaderParser headerLine;
+    headerLine.parse(fileIn);
+
+    std::string dotBracket(headerLine._numberOfBases, UNPAIRED);
+    BodyLineParser bodyLine;
+    while (bodyLine.parse(fileIn))
+    {
+        mili::assert_throw<InvalidBodyLine>(bodyLine._nucNumber > 0 && bodyLine._nucNumber <= dotBracket.size());
+        if (bodyLine._pairedNuc != 0)
+        {
+            dotBracket[bodyLine._nucNumber - 1] = bodyLine._pairedNuc > bodyLine._nucNumber ? OPEN_PAIR : CLOSE_PAIR;
+        }
+    }
+    structure.pack(dotBracket);
+    freeEnergy = headerLine._deltaG;
+}
+
+void UNAFold::prepareEnergyData(const biopp::NucSequence& sequence, const bool isCirc, etilico::Command& command, InputFile& inputFile, OutputFile& outputFile, const Temperature temp)
+{
+    std::string prefix = "fideo-XXXXXX";
+    std::string temporalFile;
+    etilico::createTemporaryFile(temporalFile, PATH_TMP, prefix);
+    inputFile = "";
+    outputFile = temporalFile;
+    std::stringstream ss;
+    ss << "hybrid-ss-min --quiet --NA=RNA ";
+    if (isCirc)
+    {
+        ss << "--circular ";
+    }
+    ss << "--tmin=" << temp << " --tmax=" << temp << " ";
+    ss << sequence.getString() << " > " << temporalFile;
+    command = ss.str(); /// hybrid-ss-min --quiet --NA=RNA ("" | --circular) --tmin=temp --tmax=temp sequence > temporalFile
+}
+
+void UNAFold::processingEnergy(const OutputFile& outputFile, Fe& freeEnergy)
+{
+    std::string output;
+    helper::readFile(outputFile, output);
+    const char* const begin = output.c_str();
+    char* end;
+    freeEnergy = strtod(begin, &end);
+    if (end == begin)
+    {
+        throw RNABackendException("Invalid hybrid-ss-min output");
+    }
+}
+
+void UNAFold::deleteFilesAfterEnergy(const InputFile& /*inFile*/, const OutputFile& outFile)
+{
+    mili::assert_throw<UnlinkException>(unlink(outFile.c_str()) == 0);
+}
+
 //------------------------------------- DetFileParser --------------------------------------
 
 void UNAFold::DetFileParser::goToBegin(File& file) const
@@ -267,10 +327,13 @@ void UNAFold::DetFileParser::buildBlock(File& file, Block& block) const
     }
 }
 
-void UNAFold::DetFileParser::parseBlock(const Block& block, IMotifObserver::Motif& motif)
+void UNAFold::DetFileParser::parseBlock(const Block& block, MotifRecord& record)
 {
     Rule* rule = _availableRules[block.motifName];
-    rule->calculateAttrib(block, motif);
+    //the .det blocks do not give the positions of every loop.
+    record.first = 0;
+    record.last = 0;
+    rule->calculateAttrib(block, record);
 }
 
 void UNAFold::DetFileParser::fillRules()
@@ -295,13 +358,15 @@ void UNAFold::DetFileParser::parseDet(const std::string& file, IMotifObserver* o
     fillRules();
     goToBegin(fileToParse);
     Block currentBlock;
-    IMotifObserver::Motif motif;
+    MotifRecord record;
+    std::vector<MotifRecord> records;
     while (!fileToParse.eof())
     {
         buildBlock(fileToParse, currentBlock);
-        parseBlock(currentBlock, motif);
-        observer->processMotif(motif);
+        parseBlock(currentBlock, record);
+        records.push_back(record);
     }
+    observer->processMotifs(records.data(), records.data() + records.size());
     observer->finalize();
 }
 
@@ -385,18 +450,18 @@ void UNAFold::DetFileParser::Rule::getSecondElement(const Body& list, std::strin
 
 static const size_t SS_EXTERNAL = 4;
 
-void UNAFold::DetFileParser::ExternalRule::calculateAttrib(const Block& block, IMotifObserver::Motif& motif) const
+void UNAFold::DetFileParser::ExternalRule::calculateAttrib(const Block& block, MotifRecord& record) const
 {
     assert(block.motifName == EXTERNAL_LOOP);
     const std::string currentLine = block.lines.front();
     std::string temporalValue;
     getSubstrInPos(currentLine, SS_EXTERNAL, temporalValue);
-    motif.nameMotif = block.motifName;
-    helper::convertFromString(temporalValue, motif.attribute);
-    motif.amountStacks = block.lines.size() - 2; //one by concreteMotif and one by helix line
+    record.kind = MotifExternalLoop;
+    helper::convertFromString(temporalValue, record.attribute);
+    record.amountStacks = uint32_t(block.lines.size() - 2); //one by concreteMotif and one by helix line
 }
 
-void UNAFold::DetFileParser::InteriorRule::calculateAttrib(const Block& block, IMotifObserver::Motif& motif) const
+void UNAFold::DetFileParser::InteriorRule::calculateAttrib(const Block& block, MotifRecord& record) const
 {
     assert(block.motifName == INTERIOR_LOOP);
     const std::string currentLine = block.lines.front();
@@ -412,25 +477,25 @@ void UNAFold::DetFileParser::InteriorRule::calculateAttrib(const Block& block, I
 
     if (firstTerm != secondTerm)
     {
-        motif.nameMotif = ASYMMETRIC;
+        record.kind = MotifInteriorAsymmetric;
         if (firstTerm >= secondTerm)
         {
-            motif.attribute = firstTerm;
+            record.attribute = uint32_t(firstTerm);
         }
         else
         {
-            motif.attribute = secondTerm;
+            record.attribute = uint32_t(secondTerm);
         }
     }
     else
     {
-        motif.nameMotif = SYMMETRIC;
-        motif.attribute = firstTerm;
+        record.kind = MotifInteriorSymmetric;
+        record.attribute = uint32_t(firstTerm);
     }
-    motif.amountStacks = block.lines.size() - 2;
+    record.amountStacks = uint32_t(block.lines.size() - 2);
 }
 
-void UNAFold::DetFileParser::HairpinRule::calculateAttrib(const Block& block, IMotifObserver::Motif& motif) const
+void UNAFold::DetFileParser::HairpinRule::calculateAttrib(const Block& block, MotifRecord& record) const
 {
     assert(block.motifName == HAIRPIN_LOOP);
     const std::string currentLine = block.lines.front();
@@ -438,33 +503,33 @@ void UNAFold::DetFileParser::HairpinRule::calculateAttrib(const Block& block, IM
     const size_t initNucleotid = getInitPosOfNucleotid(currentLine, HAIRPIN_LOOP);
     const size_t endNucleotid =  getEndPosOfNucleotid(currentLine, HAIRPIN_LOOP);
 
-    motif.nameMotif = block.motifName;
-    motif.attribute = std::abs(endNucleotid - initNucleotid);
+    record.kind = MotifHairpinLoop;
+    record.attribute = uint32_t(std::abs(endNucleotid - initNucleotid));
     if (block.lines.size() == 1)
     {
-        motif.amountStacks = 0;
+        record.amountStacks = 0;
     }
     else
     {
-        motif.amountStacks = block.lines.size() - 2;
+        record.amountStacks = uint32_t(block.lines.size() - 2);
     }
 }
 
 static const size_t SS_MULTI = 1;
 
-void UNAFold::DetFileParser::MultiRule::calculateAttrib(const Block& block, IMotifObserver::Motif& motif) const
+void UNAFold::DetFileParser::MultiRule::calculateAttrib(const Block& block, MotifRecord& record) const
 {
     assert(block.motifName == MULTI_LOOP);
     std::string currentLine;
     getSecondElement(block.lines, currentLine);
     std::string temporalValue;
     getSubstrInPos(currentLine, SS_MULTI, temporalValue);
-    helper::convertFromString(temporalValue, motif.attribute);
-    motif.nameMotif = block.motifName;
-    motif.amountStacks = block.lines.size() - 3; // the information of multi-loop motif is in 2 lines
+    helper::convertFromString(temporalValue, record.attribute);
+    record.kind = MotifMultiLoop;
+    record.amountStacks = uint32_t(block.lines.size() - 3); // the information of multi-loop motif is in 2 lines
 }
 
-void UNAFold::DetFileParser::BulgeRule::calculateAttrib(const Block& block, IMotifObserver::Motif& motif) const
+void UNAFold::DetFileParser::BulgeRule::calculateAttrib(const Block& block, MotifRecord& record) const
 {
     assert(block.motifName == BULGE_LOOP);
 
@@ -481,14 +546,14 @@ void UNAFold::DetFileParser::BulgeRule::calculateAttrib(const Block& block, IMot
 
     if (initDif == EXPECTED_DIFFERENCE)  //The bulge is on the other side
     {
-        motif.attribute = endDif;
+        record.attribute = uint32_t(endDif);
     }
     else
     {
-        motif.attribute = initDif;
+        record.attribute = uint32_t(initDif);
     }
-    motif.nameMotif = BULGE_LOOP;
-    motif.amountStacks = block.lines.size() - 2;
+    record.kind = MotifBulgeLoop;
+    record.amountStacks = uint32_t(block.lines.size() - 2);
 }
 
 //----------------------------------- Fold with observer --------------------------------------
@@ -0,0 +1,108 @@
+/*
+ * @file     ViennaFolder.cpp
+ * @brief    In-process folding with the ViennaRNA library.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Implementation of class ViennaFolder.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <cstdlib>
+#include <cctype>
+#include "fideo/ViennaFolder.h"
+#include "fideo/FideoStructureParser.h"
+#include "fideo/RnaBackendsException.h"
+
+//The library headers are plain C without linkage guards.
+extern "C"
+{
+#include <ViennaRNA/data_structures.h>
+#include <ViennaRNA/fold_vars.h>
+#include <ViennaRNA/params.h>
+#include <ViennaRNA/fold.h>
+}
+
+namespace fideo
+{
+
+ViennaFolder::ViennaFolder(const Temperature temp)
+    : parameters(NULL)
+{
+    model_detailsT details;
+    set_model_details(&details);
+    parameters = get_scaled_parameters(temp, details);
+    if (parameters == NULL)
+        throw RNABackendException("Could not get ViennaRNA energy parameters");
+}
+
+ViennaFolder::~ViennaFolder()
+{
+    free(parameters);
+    free_arrays();
+}
+
+Fe ViennaFolder::fold(const std::string& seq, const bool isCircRNA, std::string& structure)
+{
+    //the library exits the process on an empty sequence.
+    if (seq.empty())
+        throw RNABackendException("Empty sequence");
+    input.assign(seq.size() + 1, '\0');
+    for (size_t i = 0; i < seq.size(); ++i)
+    {
+        const char base = char(toupper(seq[i]));
+        input[i] = (base == 'T') ? 'U' : base;
+    }
+    buffer.assign(seq.size() + 1, '\0');
+    const float energy = fold_par(&input[0], &buffer[0], static_cast<paramT*>(parameters), 0, isCircRNA ? 1 : 0);
+    structure.assign(&buffer[0], seq.size());
+    return Fe(energy);
+}
+
+Similitude ViennaFolder::distance(const std::string& seq, const biopp::SecStructure& target)
+{
+    if (seq.size() != target.size())
+        throw RNABackendException("Sequence and target structure must have the same length");
+    std::string folded;
+    fold(seq, target.is_circular(), folded);
+    biopp::SecStructure structure;
+    ViennaParser::parseStructure(folded, structure);
+
+    Similitude result = 0;
+    for (biopp::SeqIndex i = 0; i < target.size(); ++i)
+    {
+        const bool pairedHere = structure.is_paired(i) && structure.paired_with(i) > i;
+        const bool pairedThere = target.is_paired(i) && target.paired_with(i) > i;
+        if (pairedHere && (!target.is_paired(i) || target.paired_with(i) != structure.paired_with(i)))
+            ++result;
+        if (pairedThere && (!structure.is_paired(i) || structure.paired_with(i) != target.paired_with(i)))
+            ++result;
+    }
+    return result;
+}
+
+} //namespace fideo
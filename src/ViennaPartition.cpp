@@ -0,0 +1,171 @@
+/*
+ * @file     ViennaPartition.cpp
+ * @brief    Partition function running inside the process.
+ *
+ * @author   Franco Riberi
+ * @email    fgriberi AT gmail.com
+ *
+ * Contents: Source file for fideo providing class ViennaPartition implementation.
+ *
+ * System:   fideo: Folding Interface Dynamic Exchange Operations
+ * Language: C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <cmath>
+#include <cstdlib>
+#include <cctype>
+#include "fideo/IPartitionFunction.h"
+#include "fideo/ViennaFolder.h"
+#include "fideo/RnaBackendsException.h"
+
+//The library headers are plain C without linkage guards.
+extern "C"
+{
+#include <ViennaRNA/data_structures.h>
+#include <ViennaRNA/fold_vars.h>
+#include <ViennaRNA/params.h>
+#include <ViennaRNA/part_func.h>
+#include <ViennaRNA/utils.h>
+}
+
+namespace fideo
+{
+
+/**
+ * @brief Partition function of the ViennaRNA 2.0 library
+ *
+ * Reads the probabilities straight from the matrix of the library, so
+ * no dot plot is written nor parsed. As ViennaFolder, the library keeps
+ * its arrays per thread: each thread needs its own instance.
+ */
+class ViennaPartition : public IPartitionFunction
+{
+public:
+    ViennaPartition();
+    ~ViennaPartition();
+
+private:
+    static const double SCALE_FACTOR;
+
+    virtual Fe ensembleEnergy(const biopp::NucSequence& sequence, const bool isCirc, const Temperature temp);
+    virtual Fe pairProbabilities(const biopp::NucSequence& sequence, const bool isCirc, const Probability threshold, std::vector<PairProbability>& pairs, const Temperature temp);
+
+    /**
+     * @brief Run the partition function over input
+     *
+     * @param isCirc if the sequence is circular.
+     * @param probabilities if the pair probabilities must be computed.
+     * @param temp temperature to fold.
+     * @return the free energy of the ensemble.
+     */
+    Fe run(const bool isCirc, const bool probabilities, const Temperature temp);
+
+    /**
+     * @brief Load a sequence as the library reads it
+     *
+     * @param sequence the RNA sequence.
+     */
+    void load(const biopp::NucSequence& sequence);
+
+    std::string input;
+    std::string mfe;
+};
+
+REGISTER_FACTORIZABLE_CLASS(IPartitionFunction, ViennaPartition, std::string, "ViennaPartition");
+
+/// as RNAfold: the MFE, scaled up a bit, estimates the ensemble energy to avoid overflows.
+const double ViennaPartition::SCALE_FACTOR = 1.07;
+
+ViennaPartition::ViennaPartition()
+{}
+
+ViennaPartition::~ViennaPartition()
+{
+    free_pf_arrays();
+}
+
+void ViennaPartition::load(const biopp::NucSequence& sequence)
+{
+    input = sequence.getString();
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        const char base = char(toupper(input[i]));
+        input[i] = (base == 'T') ? 'U' : base;
+    }
+}
+
+Fe ViennaPartition::run(const bool isCirc, const bool probabilities, const Temperature temp)
+{
+    if (input.empty())
+        throw RNABackendException("Empty sequence");
+    Fe minimum;
+    {
+        ViennaFolder folder(temp);
+        minimum = folder.fold(input, isCirc, mfe);
+    }
+    model_detailsT details;
+    set_model_details(&details);
+    const double kT = (temp + K0) * GASCONST / 1000.0;
+    const double scale = exp(-(SCALE_FACTOR * minimum) / kT / double(input.size()));
+    pf_paramT* const parameters = get_boltzmann_factors(temp, 1.0, details, scale);
+    if (parameters == NULL)
+        throw RNABackendException("Could not get ViennaRNA Boltzmann factors");
+    const float energy = pf_fold_par(input.c_str(), NULL, parameters, probabilities ? 1 : 0, 0, isCirc ? 1 : 0);
+    free(parameters);
+    return Fe(energy);
+}
+
+Fe ViennaPartition::ensembleEnergy(const biopp::NucSequence& sequence, const bool isCirc, const Temperature temp)
+{
+    load(sequence);
+    return run(isCirc, false, temp);
+}
+
+Fe ViennaPartition::pairProbabilities(const biopp::NucSequence& sequence, const bool isCirc, const Probability threshold, std::vector<PairProbability>& pairs, const Temperature temp)
+{
+    load(sequence);
+    const Fe energy = run(isCirc, true, temp);
+
+    /// the matrix is 1-based and indexed by iindx[i] - j, for i < j
+    const FLT_OR_DBL* const matrix = export_bppm();
+    const unsigned int length = unsigned(input.size());
+    int* const iindx = get_iindx(length);
+    pairs.clear();
+    for (unsigned int i = 1; i < length; ++i)
+    {
+        const FLT_OR_DBL* const row = matrix + iindx[i];
+        for (unsigned int j = i + 1; j <= length; ++j)
+        {
+            if (row[-int(j)] > threshold)
+            {
+                const PairProbability pair = {i - 1, j - 1, float(row[-int(j)])};
+                pairs.push_back(pair);
+            }
+        }
+    }
+    free(iindx);
+    return energy;
+}
+
+} //namespace fideo
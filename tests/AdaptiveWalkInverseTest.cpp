@@ -0,0 +1,144 @@
+/*
+ * @file      AdaptiveWalkInverseTest.cpp
+ * @brief     In-process inverse folding tests.
+ *
+ * @author    Franco Riberi
+ * @email     fgriberi AT gmail.com
+ *
+ * Contents:  Source file.
+ *
+ * System:    fideo: Folding Interface Dynamic Exchange Operations
+ * Language:  C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo.
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <set>
+#include <memory>
+#include <biopp/biopp.h>
+#include <gtest/gtest.h>
+#include "fideo/IFoldInverse.h"
+#include "fideo/ViennaFolder.h"
+#include "fideo/FideoStructureParser.h"
+#include "fideo/RnaBackendsException.h"
+
+using namespace fideo;
+
+static const std::string TARGET = "((((((....))))))...((((....))))";
+static const std::string START  = "GCACGCGUAUGCCGCAGUCAGCUAUAGCGUA";
+
+class AdaptiveWalkInverseTest : public ::testing::Test
+{
+protected:
+    biopp::SecStructure structure;
+
+    void SetUp()
+    {
+        ViennaParser::parseStructure(TARGET.c_str(), structure);
+    }
+
+    std::string foldOf(const biopp::NucSequence& seq)
+    {
+        std::string design;
+        for (size_t i = 0; i < seq.length(); ++i)
+        {
+            const char base = toupper(seq[i].as_char());
+            design += (base == 'T') ? 'U' : base;
+        }
+        ViennaFolder folder;
+        std::string folded;
+        folder.fold(design, false, folded);
+        return folded;
+    }
+};
+
+TEST(ViennaFolderTest, FoldHairpin)
+{
+    ViennaFolder folder;
+    std::string folded;
+    const Fe energy = folder.fold("GGGGAAAACCCC", false, folded);
+    EXPECT_EQ("((((....))))", folded);
+    EXPECT_LT(energy, 0);
+}
+
+TEST(ViennaFolderTest, EmptySequence)
+{
+    ViennaFolder folder;
+    std::string folded;
+    EXPECT_THROW(folder.fold("", false, folded), RNABackendException);
+}
+
+TEST_F(AdaptiveWalkInverseTest, DesignsFoldIntoTarget)
+{
+    std::unique_ptr<IFoldInverse> inverse(IFoldInverse::factory("AdaptiveWalk", InverseFoldParams(structure, 0, START.size(), 10)));
+    ASSERT_TRUE(inverse.get() != NULL);
+    inverse->set_start(biopp::NucSequence(START));
+
+    std::set<std::string> sequences;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        biopp::NucSequence seq;
+        inverse->fold_inverse(seq);
+        EXPECT_EQ(TARGET, foldOf(seq));
+        sequences.insert(seq.getString());
+    }
+    EXPECT_EQ(3u, sequences.size());
+}
+
+TEST_F(AdaptiveWalkInverseTest, KeepsFixedPositions)
+{
+    const Distance freePositions = 6;
+    std::unique_ptr<IFoldInverse> inverse(IFoldInverse::factory("AdaptiveWalk", InverseFoldParams(structure, START.size(), freePositions, 10)));
+    inverse->set_start(biopp::NucSequence(START));
+
+    biopp::NucSequence seq;
+    inverse->fold_inverse(seq);
+    ASSERT_EQ(START.size(), seq.length());
+    Distance changed = 0;
+    for (size_t i = 0; i < START.size(); ++i)
+    {
+        if (toupper(seq[i].as_char()) != START[i])
+            ++changed;
+    }
+    EXPECT_LE(changed, freePositions);
+}
+
+TEST_F(AdaptiveWalkInverseTest, ParallelDesignsFoldIntoTarget)
+{
+    std::unique_ptr<IFoldInverse> inverse(IFoldInverse::factory("AdaptiveWalk", InverseFoldParams(structure, 0, START.size(), 10, 3)));
+    inverse->set_start(biopp::NucSequence(START));
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        biopp::NucSequence seq;
+        inverse->fold_inverse(seq);
+        EXPECT_EQ(TARGET, foldOf(seq));
+    }
+}
+
+TEST(ViennaFolderTest, DistanceToTarget)
+{
+    biopp::SecStructure target;
+    ViennaParser::parseStructure("((((....))))", target);
+    ViennaFolder folder;
+    EXPECT_EQ(0u, folder.distance("ggggaaaacccc", target));
+    EXPECT_EQ(4u, folder.distance("aaaaaaaaaaaa", target));
+}
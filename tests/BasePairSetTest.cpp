@@ -0,0 +1,113 @@
+/*
+ * @file      BasePairSetTest.cpp
+ * @brief     Base pair set and comparators tests.
+ *
+ * @author    Franco Riberi
+ * @email     fgriberi AT gmail.com
+ *
+ * Contents:  Source file.
+ *
+ * System:    fideo: Folding Interface Dynamic Exchange Operations
+ * Language:  C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo.
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <memory>
+#include <biopp/biopp.h>
+#include <gtest/gtest.h>
+#include "fideo/BasePairSet.h"
+#include "fideo/IStructureCmp.h"
+#include "fideo/FideoStructureParser.h"
+
+using namespace fideo;
+
+static BasePairSet pairsOf(const std::string& dotBracket)
+{
+    biopp::SecStructure structure;
+    ViennaParser::parseStructure(dotBracket, structure);
+    return BasePairSet(structure);
+}
+
+TEST(BasePairSetTest, CountsPairs)
+{
+    const BasePairSet pairs = pairsOf("((..((...))..))..");
+
+    EXPECT_EQ(17u, pairs.size());
+    EXPECT_EQ(4u, pairs.pairs());
+}
+
+TEST(BasePairSetTest, Distance)
+{
+    const BasePairSet first = pairsOf("((..((...))..))");
+    const BasePairSet second = pairsOf("(...((...))...)");
+
+    EXPECT_EQ(0u, first.distance(first));
+    EXPECT_EQ(3u, first.common(second));
+    EXPECT_EQ(1u, first.distance(second));
+    EXPECT_EQ(first.distance(second), second.distance(first));
+    EXPECT_EQ(4u, first.distance(pairsOf("...............")));
+}
+
+TEST(BasePairSetTest, LowerBound)
+{
+    //shifted helices: no pair in common, most positions paired in both.
+    const BasePairSet first = pairsOf("(((....)))..");
+    const BasePairSet second = pairsOf("((((....))))");
+
+    EXPECT_EQ(7u, first.distance(second));
+    EXPECT_EQ(2u, first.lowerBound(second));
+    EXPECT_TRUE(first.within(second, 7));
+    EXPECT_FALSE(first.within(second, 6));
+    EXPECT_FALSE(first.within(pairsOf("............"), 2));
+}
+
+TEST(BasePairSetTest, SpansSeveralWords)
+{
+    const std::string hairpin = "((((((((((((((((((((((((((((((((((((((((....))))))))))))))))))))))))))))))))))))))))";
+    const std::string opened(hairpin.size(), '.');
+    const BasePairSet pairs = pairsOf(hairpin);
+
+    EXPECT_EQ(40u, pairs.pairs());
+    EXPECT_EQ(40u, pairs.lowerBound(pairsOf(opened)));
+    EXPECT_EQ(40u, pairs.distance(pairsOf(opened)));
+}
+
+TEST(BasePairSetTest, Overlap)
+{
+    EXPECT_DOUBLE_EQ(1.0, pairsOf("....").overlap(pairsOf("....")));
+    EXPECT_DOUBLE_EQ(0.0, pairsOf("(...)").overlap(pairsOf(".....")));
+    EXPECT_DOUBLE_EQ(6.0 / 7.0, pairsOf("((..((...))..))").overlap(pairsOf("(...((...))...)")));
+}
+
+TEST(BasePairSetTest, Comparators)
+{
+    biopp::SecStructure s1;
+    biopp::SecStructure s2;
+    ViennaParser::parseStructure("((..((...))..))", s1);
+    ViennaParser::parseStructure("(...((...))...)", s2);
+
+    std::unique_ptr<IStructureCmp> distance(IStructureCmp::Factory::new_class("BasePairDistance"));
+    std::unique_ptr<IStructureCmp> overlap(IStructureCmp::Factory::new_class("BasePairOverlap"));
+    EXPECT_FLOAT_EQ(1.0f, distance->compare(s1, s2));
+    EXPECT_FLOAT_EQ(0.0f, distance->compare(s2, s2));
+    EXPECT_FLOAT_EQ(6.0f / 7.0f, overlap->compare(s1, s2));
+}
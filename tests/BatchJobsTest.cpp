@@ -0,0 +1,164 @@
+/*
+ * @file      BatchJobsTest.cpp
+ * @brief     BatchJobsTest is a test file to the batch services with deduplication.
+ *
+ * @author    Franco Riberi
+ * @email     fgriberi AT gmail.com
+ *
+ * Contents:  Source file.
+ *
+ * System:    fideo: Folding Interface Dynamic Exchange Operations
+ * Language:  C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo.
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <biopp/biopp.h>
+#include <gtest/gtest.h>
+#include "fideo/BatchJobs.h"
+
+using namespace fideo;
+
+/** Counts the folds; the energy depends on the whole key. */
+class CountingFold : public IFold
+{
+public:
+    CountingFold()
+        : calls(0)
+    {}
+
+    virtual Fe fold(const biopp::NucSequence&, const bool, biopp::SecStructure&, const Temperature)
+    {
+        return 0;
+    }
+    virtual Fe fold(const biopp::NucSequence&, const bool, biopp::SecStructure&, IMotifObserver*, const Temperature)
+    {
+        return 0;
+    }
+    virtual void foldTo(const biopp::NucSequence&, const bool, biopp::SecStructure&, const FilePath&, const Temperature) {}
+    virtual void foldTo(const biopp::NucSequence&, const bool, biopp::SecStructure&, const FilePath&, IMotifObserver*, const Temperature) {}
+    virtual Fe foldFrom(const FilePath&, biopp::SecStructure&)
+    {
+        return 0;
+    }
+    virtual Fe foldFrom(const FilePath&, biopp::SecStructure&, IMotifObserver*)
+    {
+        return 0;
+    }
+    virtual Fe foldEnergy(const biopp::NucSequence& seqRNAm, const bool isCircRNAm, const Temperature temp)
+    {
+        return -Fe(seqRNAm.length()) - (isCircRNAm ? 100 : 0) - temp / 1000;
+    }
+    virtual void foldLazy(const biopp::NucSequence& seqRNAm, const bool isCircRNAm, FoldResult& result, const Temperature temp)
+    {
+        ++calls;
+        PackedStructure packed;
+        packed.pack(std::string(seqRNAm.length(), '.'));
+        result.assign(foldEnergy(seqRNAm, isCircRNAm, temp), isCircRNAm, packed);
+    }
+
+    size_t calls;
+};
+
+/** Counts the hybridizations; the energy depends on the whole key. */
+class CountingHybridize : public IHybridize
+{
+public:
+    CountingHybridize()
+        : calls(0)
+    {}
+
+    virtual Fe hybridize(const biopp::NucSequence& longerSeq, const bool longerCirc, const biopp::NucSequence& shorterSeq, const Temperature temp) const
+    {
+        ++calls;
+        return -Fe(longerSeq.length() * 10 + shorterSeq.length()) - (longerCirc ? 1000 : 0) - temp / 1000;
+    }
+
+    mutable size_t calls;
+};
+
+TEST(BatchJobsTestSuite, FoldDuplicates)
+{
+    const biopp::NucSequence a("AAAAGGGGCCCCUUUU");
+    const biopp::NucSequence b("ACGUACGU");
+    std::vector<FoldJob> jobs;
+    jobs.push_back(FoldJob(a, false));
+    jobs.push_back(FoldJob(b, false));
+    jobs.push_back(FoldJob(a, false));
+    jobs.push_back(FoldJob(a, true));
+    jobs.push_back(FoldJob(a, false, 40));
+    jobs.push_back(FoldJob(b, false));
+
+    CountingFold folder;
+    std::vector<FoldResult> results;
+    DedupReport report;
+    foldBatch(folder, jobs, results, report);
+
+    EXPECT_EQ(4u, folder.calls);
+    EXPECT_EQ(6u, report.total);
+    EXPECT_EQ(4u, report.distinct);
+    EXPECT_DOUBLE_EQ(2.0 / 6.0, report.ratio());
+    ASSERT_EQ(jobs.size(), results.size());
+    for (size_t i = 0; i < jobs.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(folder.foldEnergy(jobs[i].sequence, jobs[i].circular, jobs[i].temp), results[i].energy());
+        EXPECT_EQ(jobs[i].circular, results[i].circular());
+        EXPECT_EQ(jobs[i].sequence.length(), results[i].size());
+    }
+}
+
+TEST(BatchJobsTestSuite, HybridizeDuplicates)
+{
+    const biopp::NucSequence target("AAAAGGGGCCCCUUUU");
+    const biopp::NucSequence mirna1("ACGUACGU");
+    const biopp::NucSequence mirna2("UGCAUGCA");
+    std::vector<HybridizeJob> jobs;
+    jobs.push_back(HybridizeJob(target, false, mirna1));
+    jobs.push_back(HybridizeJob(target, false, mirna2));
+    jobs.push_back(HybridizeJob(target, false, mirna1));
+    jobs.push_back(HybridizeJob(target, false, mirna1));
+    jobs.push_back(HybridizeJob(mirna1, false, target));
+
+    CountingHybridize hybridizer;
+    std::vector<Fe> results;
+    DedupReport report;
+    hybridizeBatch(hybridizer, jobs, results, report);
+
+    EXPECT_EQ(3u, hybridizer.calls);
+    EXPECT_EQ(5u, report.total);
+    EXPECT_EQ(3u, report.distinct);
+    ASSERT_EQ(jobs.size(), results.size());
+    EXPECT_DOUBLE_EQ(results[0], results[2]);
+    EXPECT_DOUBLE_EQ(results[0], results[3]);
+    EXPECT_NE(results[0], results[4]);
+}
+
+TEST(BatchJobsTestSuite, EmptyBatch)
+{
+    CountingFold folder;
+    std::vector<FoldJob> jobs;
+    std::vector<FoldResult> results;
+    DedupReport report;
+    foldBatch(folder, jobs, results, report);
+    EXPECT_TRUE(results.empty());
+    EXPECT_EQ(0u, report.distinct);
+    EXPECT_DOUBLE_EQ(0.0, report.ratio());
+}
@@ -0,0 +1,139 @@
+/*
+ * @file      CombinatorTest.cpp
+ * @brief     CombinatorTest is a test file to the combinations enumerator.
+ *
+ * @author    Franco Riberi
+ * @email     fgriberi AT gmail.com
+ *
+ * Contents:  Source file.
+ *
+ * System:    fideo: Folding Interface Dynamic Exchange Operations
+ * Language:  C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo.
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <set>
+#include <list>
+#include <gtest/gtest.h>
+#include "fideo/Combinator.h"
+
+using namespace fideo;
+
+TEST(CombinatorTestSuite, AllCombinationsInOrder)
+{
+    SeqIndexesCombinator combinator(5, 3);
+    EXPECT_EQ(10u, combinator.size());
+
+    SeqIndexesCombination comb;
+    SeqIndexesCombination previous;
+    std::set<SeqIndexesCombination> seen;
+    for (SeqIndexesCombinator::Rank rank = 0; rank < combinator.size(); ++rank)
+    {
+        EXPECT_EQ(rank, combinator.position());
+        EXPECT_TRUE(combinator.next(comb));
+        ASSERT_EQ(3u, comb.size());
+        EXPECT_LT(comb[0], comb[1]);
+        EXPECT_LT(comb[1], comb[2]);
+        if (rank > 0)
+        {
+            EXPECT_LT(previous, comb);
+        }
+        SeqIndexesCombination unranked;
+        combinator.unrank(rank, unranked);
+        EXPECT_EQ(comb, unranked);
+        seen.insert(comb);
+        previous = comb;
+    }
+    EXPECT_EQ(10u, seen.size());
+
+    //cyclic: the first combination comes back, flagged.
+    EXPECT_FALSE(combinator.next(comb));
+    EXPECT_EQ(*seen.begin(), comb);
+    EXPECT_TRUE(combinator.next(comb));
+}
+
+TEST(CombinatorTestSuite, ElementsContainer)
+{
+    std::list<char> elements;
+    elements.push_back('a');
+    elements.push_back('b');
+    elements.push_back('c');
+    Combinator<std::list<char> > combinator(elements, 2);
+    Combinator<std::list<char> >::Combination comb;
+    combinator.next(comb);
+    EXPECT_EQ("ab", std::string(comb.begin(), comb.end()));
+    combinator.next(comb);
+    EXPECT_EQ("ac", std::string(comb.begin(), comb.end()));
+    combinator.next(comb);
+    EXPECT_EQ("bc", std::string(comb.begin(), comb.end()));
+    EXPECT_THROW(Combinator<std::list<char> >(elements, 4), CombinatorException);
+}
+
+TEST(CombinatorTestSuite, PartitionsAreDisjointAndComplete)
+{
+    SeqIndexesCombinator whole(12, 4);
+    const SeqIndexesCombinator::Rank total = whole.size();
+    EXPECT_EQ(495u, total);
+
+    std::set<SeqIndexesCombination> seen;
+    static const size_t PARTS = 7;
+    for (size_t part = 0; part < PARTS; ++part)
+    {
+        SeqIndexesCombinator combinator(12, 4);
+        combinator.partition(PARTS, part);
+        SeqIndexesCombination comb;
+        while (combinator.next(comb))
+        {
+            EXPECT_TRUE(seen.insert(comb).second);
+            if (combinator.position() == 0 || seen.size() > total)
+                break;
+        }
+    }
+    EXPECT_EQ(total, seen.size());
+}
+
+TEST(CombinatorTestSuite, SeekAndUpdate)
+{
+    SeqIndexesCombinator combinator(10, 2);
+    SeqIndexesCombination comb;
+    combinator.seek(44);
+    EXPECT_TRUE(combinator.next(comb));
+    EXPECT_EQ(8u, comb[0]);
+    EXPECT_EQ(9u, comb[1]);
+    EXPECT_THROW(combinator.seek(45), CombinatorException);
+
+    combinator.update(3);
+    EXPECT_EQ(120u, combinator.size());
+    combinator.next(comb);
+    ASSERT_EQ(3u, comb.size());
+    EXPECT_EQ(2u, comb[2]);
+}
+
+TEST(CombinatorTestSuite, HugeSpace)
+{
+    SeqIndexesCombinator combinator(2000, 40);
+    EXPECT_THROW(combinator.size(), CombinatorException);
+    SeqIndexesCombination comb;
+    EXPECT_TRUE(combinator.next(comb));
+    EXPECT_TRUE(combinator.next(comb));
+    EXPECT_EQ(40u, comb[39]);
+}
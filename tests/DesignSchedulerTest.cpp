@@ -0,0 +1,224 @@
+/*
+ * @file      DesignSchedulerTest.cpp
+ * @brief     Design scheduler tests.
+ *
+ * @author    Franco Riberi
+ * @email     fgriberi AT gmail.com
+ *
+ * Contents:  Source file.
+ *
+ * System:    fideo: Folding Interface Dynamic Exchange Operations
+ * Language:  C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo.
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <map>
+#include <vector>
+#include <set>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <biopp/biopp.h>
+#include <gtest/gtest.h>
+#include "fideo/DesignScheduler.h"
+#include "fideo/FideoStructureParser.h"
+#include "fideo/RnaBackendsException.h"
+
+using namespace fideo;
+
+static const size_t SLOW_SIZE = 8;
+static const size_t ODD_SIZE = 6;
+
+/** Parallel attempts and designs per run of the backends created. */
+static std::mutex paramsLock;
+static std::set<std::pair<size_t, size_t> > seenParams;
+
+/** Fake backend: yields the start, slowly for the structures of SLOW_SIZE; throws a non std::exception for ODD_SIZE. */
+class FakeDesigner : public IFoldInverse
+{
+public:
+    FakeDesigner(const InverseFoldParams& params)
+        : size(params.structure.size()), produced(0)
+    {
+        std::lock_guard<std::mutex> guard(paramsLock);
+        seenParams.insert(std::make_pair(params.pa, params.dr));
+    }
+
+    virtual void fold_inverse(biopp::NucSequence& sequence, const Temperature)
+    {
+        if (budget.attempts > 0 && produced >= budget.attempts)
+            throw DesignBudgetExhausted();
+        if (size == ODD_SIZE)
+            throw size;
+        if (size == SLOW_SIZE)
+            std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        ++produced;
+        sequence = start;
+    }
+
+    virtual void set_start(const biopp::NucSequence& seq)
+    {
+        start = seq;
+    }
+
+    virtual void query_start(IStartProvider*) {}
+
+    virtual void set_budget(const DesignBudget& newBudget)
+    {
+        budget = newBudget;
+    }
+
+    virtual void save_state(std::ostream&) const {}
+
+    virtual void load_state(std::istream&) {}
+
+private:
+    const size_t size;
+    size_t produced;
+    biopp::NucSequence start;
+    DesignBudget budget;
+};
+
+REGISTER_FACTORIZABLE_CLASS_WITH_ARG(IFoldInverse, FakeDesigner, std::string, "FakeDesigner", const InverseFoldParams&);
+
+struct RecordingSink : public IDesignSink
+{
+    virtual void designed(const size_t job, const biopp::NucSequence&)
+    {
+        ++designs[job];
+        workers[job] = std::this_thread::get_id();
+    }
+
+    virtual void finished(const size_t job, const DesignJobStatus status, const size_t count)
+    {
+        statuses[job] = status;
+        counts[job] = count;
+    }
+
+    std::map<size_t, size_t> designs;
+    std::map<size_t, std::thread::id> workers;
+    std::map<size_t, DesignJobStatus> statuses;
+    std::map<size_t, size_t> counts;
+};
+
+class DesignSchedulerTest : public ::testing::Test
+{
+protected:
+    biopp::SecStructure fast;
+    biopp::SecStructure slow;
+
+    void SetUp()
+    {
+        ViennaParser::parseStructure("....", fast);
+        ViennaParser::parseStructure("((....))", slow);
+    }
+};
+
+TEST_F(DesignSchedulerTest, AllJobsAreDesigned)
+{
+    std::vector<DesignJob> jobs;
+    for (size_t i = 0; i < 10; ++i)
+    {
+        jobs.push_back(DesignJob(InverseFoldParams(fast, 0, 2, 10), biopp::NucSequence("ACGU"), 3));
+    }
+    RecordingSink sink;
+    DesignScheduler(std::string("FakeDesigner"), 3).run(jobs, sink);
+
+    ASSERT_EQ(10u, sink.statuses.size());
+    for (size_t i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(JobCompleted, sink.statuses[i]);
+        EXPECT_EQ(3u, sink.counts[i]);
+        EXPECT_EQ(3u, sink.designs[i]);
+    }
+}
+
+TEST_F(DesignSchedulerTest, IdleWorkersStealJobs)
+{
+    //the first worker gets the slow job and jobs 2 and 4.
+    std::vector<DesignJob> jobs;
+    jobs.push_back(DesignJob(InverseFoldParams(slow, 0, 2, 10), biopp::NucSequence("GGAAAACC"), 1));
+    for (size_t i = 0; i < 5; ++i)
+    {
+        jobs.push_back(DesignJob(InverseFoldParams(fast, 0, 2, 10), biopp::NucSequence("ACGU"), 1));
+    }
+    RecordingSink sink;
+    DesignScheduler(std::string("FakeDesigner"), 2).run(jobs, sink);
+
+    EXPECT_NE(sink.workers[0], sink.workers[2]);
+    EXPECT_NE(sink.workers[0], sink.workers[4]);
+}
+
+TEST_F(DesignSchedulerTest, BudgetEndsJob)
+{
+    std::vector<DesignJob> jobs;
+    jobs.push_back(DesignJob(InverseFoldParams(fast, 0, 2, 10), biopp::NucSequence("ACGU"), 5, DesignBudget(2)));
+    RecordingSink sink;
+    DesignScheduler(std::string("FakeDesigner"), 1).run(jobs, sink);
+
+    EXPECT_EQ(JobBudgetExhausted, sink.statuses[0]);
+    EXPECT_EQ(2u, sink.counts[0]);
+    EXPECT_EQ(2u, sink.designs[0]);
+}
+
+TEST_F(DesignSchedulerTest, UnknownBackendFailsJobs)
+{
+    std::vector<DesignJob> jobs(2, DesignJob(InverseFoldParams(fast, 0, 2, 10), biopp::NucSequence("ACGU"), 1));
+    RecordingSink sink;
+    DesignScheduler(std::string("NoSuchBackend"), 2).run(jobs, sink);
+
+    EXPECT_EQ(JobFailed, sink.statuses[0]);
+    EXPECT_EQ(JobFailed, sink.statuses[1]);
+    EXPECT_EQ(0u, sink.designs.size());
+}
+
+TEST_F(DesignSchedulerTest, JobsHaveTheirOwnParams)
+{
+    std::vector<DesignJob> jobs;
+    jobs.push_back(DesignJob(InverseFoldParams(fast, 0, 2, 10, 3, 5), biopp::NucSequence("ACGU"), 1));
+    jobs.push_back(DesignJob(InverseFoldParams(slow, 0, 2, 10, 2, 1, 0, 1, true), biopp::NucSequence("GGAAAACC"), 1));
+    seenParams.clear();
+    RecordingSink sink;
+    DesignScheduler(std::string("FakeDesigner"), 2).run(jobs, sink);
+
+    EXPECT_EQ(2u, seenParams.size());
+    EXPECT_EQ(1u, seenParams.count(std::make_pair(size_t(3), size_t(5))));
+    EXPECT_EQ(1u, seenParams.count(std::make_pair(size_t(2), size_t(1))));
+    EXPECT_EQ(8u, jobs[1].params.structure.size());
+    EXPECT_TRUE(jobs[1].params.vf);
+}
+
+TEST_F(DesignSchedulerTest, AnyExceptionFailsOnlyItsJob)
+{
+    biopp::SecStructure odd;
+    ViennaParser::parseStructure("(....)", odd);
+    std::vector<DesignJob> jobs;
+    jobs.push_back(DesignJob(InverseFoldParams(odd, 0, 2, 10), biopp::NucSequence("GAAAAC"), 1));
+    jobs.push_back(DesignJob(InverseFoldParams(fast, 0, 2, 10), biopp::NucSequence("ACGU"), 2));
+    RecordingSink sink;
+    DesignScheduler(std::string("FakeDesigner"), 2).run(jobs, sink);
+
+    EXPECT_EQ(JobFailed, sink.statuses[0]);
+    EXPECT_EQ(0u, sink.counts[0]);
+    EXPECT_EQ(JobCompleted, sink.statuses[1]);
+    EXPECT_EQ(2u, sink.counts[1]);
+}
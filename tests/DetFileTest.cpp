@@ -195,12 +195,12 @@ TEST(DetFileParserTestSuite, ExternalRulecalculateAttribTest)
     const size_t stacks = 3;
 
     UNAFold::DetFileParser::ExternalRule externalRule;
-    IMotifObserver::Motif motif;
-    externalRule.calculateAttrib(externalLoopBlock, motif);
+    MotifRecord record;
+    externalRule.calculateAttrib(externalLoopBlock, record);
 
-    EXPECT_EQ(motif.nameMotif, EXTERNAL_LOOP);
-    EXPECT_EQ(motif.attribute, attr);
-    EXPECT_EQ(motif.amountStacks, stacks);
+    EXPECT_EQ(MotifExternalLoop, MotifKind(record.kind));
+    EXPECT_EQ(record.attribute, attr);
+    EXPECT_EQ(record.amountStacks, stacks);
 
     // build incorrect block
     Block invalidBlock;
@@ -211,7 +211,7 @@ TEST(DetFileParserTestSuite, ExternalRulecalculateAttribTest)
     invalidBlock.lines.push_back("Stack: ddG = -2.40 External closing pair is C( 4)-G( 202)");
     invalidBlock.lines.push_back("Helix: ddG = -7.90 4 base pairs.");
 
-    ASSERT_DEATH(externalRule.calculateAttrib(invalidBlock, motif), "");
+    ASSERT_DEATH(externalRule.calculateAttrib(invalidBlock, record), "");
 }
 
 TEST(DetFileParserTestSuite, InteriorRulecalculateAttribTest)
@@ -228,12 +228,12 @@ TEST(DetFileParserTestSuite, InteriorRulecalculateAttribTest)
     const size_t stacks = 2;
 
     UNAFold::DetFileParser::InteriorRule interiorRule;
-    IMotifObserver::Motif motif;
-    interiorRule.calculateAttrib(interiorLoopBlock, motif);
+    MotifRecord record;
+    interiorRule.calculateAttrib(interiorLoopBlock, record);
 
-    EXPECT_EQ(motif.nameMotif, ASYMMETRIC);
-    EXPECT_EQ(motif.attribute, attr);
-    EXPECT_EQ(motif.amountStacks, stacks);
+    EXPECT_EQ(MotifInteriorAsymmetric, MotifKind(record.kind));
+    EXPECT_EQ(record.attribute, attr);
+    EXPECT_EQ(record.amountStacks, stacks);
 
     // build incorrect block
     Block invalidBlock;
@@ -244,7 +244,7 @@ TEST(DetFileParserTestSuite, InteriorRulecalculateAttribTest)
     invalidBlock.lines.push_back("Stack: ddG = -2.40 External closing pair is C( 4)-G( 202)");
     invalidBlock.lines.push_back("Helix: ddG = -7.90 4 base pairs.");
 
-    EXPECT_THROW(interiorRule.calculateAttrib(invalidBlock, motif), IndexOutOfRange);
+    EXPECT_THROW(interiorRule.calculateAttrib(invalidBlock, record), IndexOutOfRange);
 }
 
 TEST(DetFileParserTestSuite, HairpinRulecalculateAttribTest)
@@ -262,12 +262,12 @@ TEST(DetFileParserTestSuite, HairpinRulecalculateAttribTest)
     const size_t stacks = 3;
 
     UNAFold::DetFileParser::HairpinRule hairpinRule;
-    IMotifObserver::Motif motif;
-    hairpinRule.calculateAttrib(hairpinLoopBlock, motif);
+    MotifRecord record;
+    hairpinRule.calculateAttrib(hairpinLoopBlock, record);
 
-    EXPECT_EQ(motif.nameMotif, HAIRPIN_LOOP);
-    EXPECT_EQ(motif.attribute, attr);
-    EXPECT_EQ(motif.amountStacks, stacks);
+    EXPECT_EQ(MotifHairpinLoop, MotifKind(record.kind));
+    EXPECT_EQ(record.attribute, attr);
+    EXPECT_EQ(record.amountStacks, stacks);
 
     // build other block
     Block withoutStackBlock;
@@ -277,11 +277,11 @@ TEST(DetFileParserTestSuite, HairpinRulecalculateAttribTest)
     const size_t numAttrib = 4;
     const size_t amountStacks = 0;
 
-    hairpinRule.calculateAttrib(withoutStackBlock, motif);
+    hairpinRule.calculateAttrib(withoutStackBlock, record);
 
-    EXPECT_EQ(motif.nameMotif, HAIRPIN_LOOP);
-    EXPECT_EQ(motif.attribute, numAttrib);
-    EXPECT_EQ(motif.amountStacks, amountStacks);
+    EXPECT_EQ(MotifHairpinLoop, MotifKind(record.kind));
+    EXPECT_EQ(record.attribute, numAttrib);
+    EXPECT_EQ(record.amountStacks, amountStacks);
 }
 
 TEST(DetFileParserTestSuite, MultiLoopRulecalculateAttribTest)
@@ -303,12 +303,12 @@ TEST(DetFileParserTestSuite, MultiLoopRulecalculateAttribTest)
     const size_t stacks = 6;
 
     UNAFold::DetFileParser::MultiRule multiRule;
-    IMotifObserver::Motif motif;
-    multiRule.calculateAttrib(multiLoopBlock, motif);
+    MotifRecord record;
+    multiRule.calculateAttrib(multiLoopBlock, record);
 
-    EXPECT_EQ(motif.nameMotif, MULTI_LOOP);
-    EXPECT_EQ(motif.attribute, attr);
-    EXPECT_EQ(motif.amountStacks, stacks);
+    EXPECT_EQ(MotifMultiLoop, MotifKind(record.kind));
+    EXPECT_EQ(record.attribute, attr);
+    EXPECT_EQ(record.amountStacks, stacks);
 }
 
 TEST(DetFileParserTestSuite, BulgeRulecalculateAttribTest)
@@ -327,12 +327,12 @@ TEST(DetFileParserTestSuite, BulgeRulecalculateAttribTest)
     const size_t stacks = 4;
 
     UNAFold::DetFileParser::BulgeRule bulgeRule;
-    IMotifObserver::Motif motif;
-    bulgeRule.calculateAttrib(bulgeLoopBlock, motif);
+    MotifRecord record;
+    bulgeRule.calculateAttrib(bulgeLoopBlock, record);
 
-    EXPECT_EQ(motif.nameMotif, BULGE_LOOP);
-    EXPECT_EQ(motif.attribute, attr);
-    EXPECT_EQ(motif.amountStacks, stacks);
+    EXPECT_EQ(MotifBulgeLoop, MotifKind(record.kind));
+    EXPECT_EQ(record.attribute, attr);
+    EXPECT_EQ(record.amountStacks, stacks);
 }
 
 static const std::string DET_FILE_PATH = "../../../projects/fideo/tests/fileToParse.det";
@@ -381,25 +381,25 @@ TEST(DetFileParserTestSuite, builBlockAndParserBlockTest)
     Block block;
     parser.buildBlock(fileToParse, block);
 
-    IMotifObserver::Motif motif;
-    parser.parseBlock(block, motif);
-    EXPECT_EQ(motif.nameMotif, block.motifName);
-    EXPECT_EQ(motif.attribute, 16);
-    EXPECT_EQ(motif.amountStacks, 3);
+    MotifRecord record;
+    parser.parseBlock(block, record);
+    EXPECT_EQ(block.motifName, motifName(MotifKind(record.kind)));
+    EXPECT_EQ(record.attribute, 16);
+    EXPECT_EQ(record.amountStacks, 3);
     block.lines.clear();
 
     parser.buildBlock(fileToParse, block);
-    parser.parseBlock(block, motif);
-    EXPECT_EQ(motif.nameMotif, block.motifName);
-    EXPECT_EQ(motif.attribute, 17);
-    EXPECT_EQ(motif.amountStacks, 4);
+    parser.parseBlock(block, record);
+    EXPECT_EQ(block.motifName, motifName(MotifKind(record.kind)));
+    EXPECT_EQ(record.attribute, 17);
+    EXPECT_EQ(record.amountStacks, 4);
     block.lines.clear();
 
     parser.buildBlock(fileToParse, block);
-    parser.parseBlock(block, motif);
-    EXPECT_EQ(motif.nameMotif, block.motifName);
-    EXPECT_EQ(motif.attribute, 3);
-    EXPECT_EQ(motif.amountStacks, 2);
+    parser.parseBlock(block, record);
+    EXPECT_EQ(block.motifName, motifName(MotifKind(record.kind)));
+    EXPECT_EQ(record.attribute, 3);
+    EXPECT_EQ(record.amountStacks, 2);
 
     Block expectedBlock;
     expectedBlock.motifName = "Multi-loop";
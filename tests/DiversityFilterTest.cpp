@@ -0,0 +1,112 @@
+/*
+ * @file      DiversityFilterTest.cpp
+ * @brief     Diversity filter tests.
+ *
+ * @author    Franco Riberi
+ * @email     fgriberi AT gmail.com
+ *
+ * Contents:  Source file.
+ *
+ * System:    fideo: Folding Interface Dynamic Exchange Operations
+ * Language:  C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo.
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <string>
+#include <gtest/gtest.h>
+#include "fideo/DiversityFilter.h"
+
+using namespace fideo;
+
+TEST(DiversityFilterTest, HammingOfPackedSequences)
+{
+    EXPECT_EQ(0u, PackedSequence("ACGT").hamming(PackedSequence("acgu")));
+    EXPECT_EQ(2u, PackedSequence("ACGU").hamming(PackedSequence("AGGA")));
+
+    //spans two words
+    const std::string longer(40, 'A');
+    std::string other = longer;
+    other[3] = 'C';
+    other[35] = 'U';
+    EXPECT_EQ(2u, PackedSequence(longer).hamming(PackedSequence(other)));
+    EXPECT_THROW(PackedSequence("ACGU").hamming(PackedSequence("ACG")), IndexOutOfRange);
+}
+
+TEST(DiversityFilterTest, ArithmeticCountMatchesPopcount)
+{
+    uint64_t a = 0x0123456789ABCDEFULL;
+    uint64_t b = 0xFEDCBA9876543210ULL;
+    for (size_t i = 0; i < 64; ++i)
+    {
+        EXPECT_EQ(size_t(__builtin_popcountll(PackedSequence::differingBases(a, b))), PackedSequence::differingBasesArithmetic(a, b));
+        a = a * 6364136223846793005ULL + 1442695040888963407ULL;
+        b ^= a >> (i % 7);
+    }
+    EXPECT_EQ(32u, PackedSequence::differingBasesArithmetic(0, ~uint64_t(0)));
+    EXPECT_EQ(0u, PackedSequence::differingBasesArithmetic(a, a));
+}
+
+TEST(DiversityFilterTest, RejectsNearDesigns)
+{
+    DiversityFilter filter(2);
+    filter.insert(PackedSequence("ACGUACGUACGU"));
+    EXPECT_FALSE(filter.admits(PackedSequence("ACGUACGUACGU")));
+    EXPECT_FALSE(filter.admits(PackedSequence("CCGUACGUACGA")));
+    EXPECT_TRUE(filter.admits(PackedSequence("CCGUACGUAGGA")));
+    EXPECT_EQ(1u, filter.size());
+}
+
+TEST(DiversityFilterTest, ChecksEveryDesign)
+{
+    //more designs than a block, the near one at the end.
+    DiversityFilter filter(1);
+    std::string design(50, 'A');
+    for (size_t i = 0; i < 40; ++i)
+    {
+        design[i] = 'G';
+        filter.insert(PackedSequence(design));
+        design[i] = 'A';
+    }
+    std::string candidate(50, 'A');
+    candidate[39] = 'G';
+    candidate[49] = 'C';
+    EXPECT_FALSE(filter.admits(PackedSequence(candidate)));
+    candidate[48] = 'C';
+    EXPECT_TRUE(filter.admits(PackedSequence(candidate)));
+}
+
+TEST(DiversityFilterTest, DisabledFilterAdmitsAll)
+{
+    DiversityFilter filter;
+    filter.insert(PackedSequence("ACGU"));
+    EXPECT_FALSE(filter.enabled());
+    EXPECT_EQ(0u, filter.size());
+    EXPECT_TRUE(filter.admits(PackedSequence("ACGU")));
+}
+
+TEST(DiversityFilterTest, Clear)
+{
+    DiversityFilter filter(1);
+    filter.insert(PackedSequence("ACGU"));
+    filter.clear();
+    EXPECT_TRUE(filter.admits(PackedSequence("ACGUA")));
+}
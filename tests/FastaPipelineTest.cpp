@@ -0,0 +1,193 @@
+/*
+ * @file      FastaPipelineTest.cpp
+ * @brief     RNAFoldTest is a test file to the FASTA reader and pipelines.
+ *
+ * @author    Franco Riberi
+ * @email     fgriberi AT gmail.com
+ *
+ * Contents:  Source file.
+ *
+ * System:    fideo: Folding Interface Dynamic Exchange Operations
+ * Language:  C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo.
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <fstream>
+#include <set>
+#include <biopp/biopp.h>
+#include <etilico/etilico.h>
+#include <gtest/gtest.h>
+#include "fideo/FastaPipeline.h"
+#include "fideo/IFold.h"
+#include "HelperTest.h"
+
+using namespace fideo;
+
+static const FilePath FASTA_FILE = "/tmp/fideo-pipeline.fa";
+
+static void writeFasta(const FilePath& file)
+{
+    std::ofstream out(file.c_str());
+    out << ";comment\n";
+    out << ">seq1 first sequence\n";
+    out << "ACGU\n";
+    out << "ACGU\r\n";
+    out << "\n";
+    out << ">seq2\n";
+    out << "GGGG";
+}
+
+TEST(FastaPipelineTestSuite, ReadPlainFile)
+{
+    writeFasta(FASTA_FILE);
+    FastaReader reader(FASTA_FILE);
+    FastaRecord record;
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.index, 0);
+    EXPECT_EQ(record.name, "seq1 first sequence");
+    EXPECT_EQ(record.sequence, "ACGUACGU");
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.index, 1);
+    EXPECT_EQ(record.name, "seq2");
+    EXPECT_EQ(record.sequence, "GGGG");
+    EXPECT_FALSE(reader.next(record));
+    unlink(FASTA_FILE.c_str());
+    EXPECT_FALSE(HelperTest::checkDirTmp());
+}
+
+TEST(FastaPipelineTestSuite, ReadCompressedFile)
+{
+    writeFasta(FASTA_FILE);
+    const etilico::Command cmd = "gzip -f " + FASTA_FILE;
+    ASSERT_EQ(etilico::runCommand(cmd), 0);
+    const FilePath compressed = FASTA_FILE + ".gz";
+
+    FastaReader reader(compressed);
+    FastaRecord record;
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.sequence, "ACGUACGU");
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.name, "seq2");
+    EXPECT_EQ(record.sequence, "GGGG");
+    EXPECT_FALSE(reader.next(record));
+    unlink(compressed.c_str());
+    EXPECT_FALSE(HelperTest::checkDirTmp());
+}
+
+TEST(FastaPipelineTestSuite, SequenceWithoutHeader)
+{
+    {
+        std::ofstream out(FASTA_FILE.c_str());
+        out << "ACGU\n>seq1\nACGU\n";
+    }
+    FastaReader reader(FASTA_FILE);
+    FastaRecord record;
+    EXPECT_THROW(reader.next(record), InvalidFastaFile);
+    unlink(FASTA_FILE.c_str());
+}
+
+TEST(FastaPipelineTestSuite, FileNotExist)
+{
+    EXPECT_THROW(FastaReader reader("/tmp/fideo-FileNotExist"), NotFoundFileException);
+}
+
+/** Fake backend: the energy is minus the length of the sequence. */
+class FakeFold : public IFold
+{
+    virtual Fe fold(const biopp::NucSequence& seqRNAm, const bool isCircRNAm, biopp::SecStructure& structureRNAm, const Temperature /*temp*/)
+    {
+        structureRNAm.clear();
+        structureRNAm.set_circular(isCircRNAm);
+        structureRNAm.set_sequence_size(seqRNAm.length());
+        return -Fe(seqRNAm.length());
+    }
+    virtual Fe fold(const biopp::NucSequence& seqRNAm, const bool isCircRNAm, biopp::SecStructure& structureRNAm, IMotifObserver*, const Temperature temp)
+    {
+        return fold(seqRNAm, isCircRNAm, structureRNAm, temp);
+    }
+    virtual void foldTo(const biopp::NucSequence&, const bool, biopp::SecStructure&, const FilePath&, const Temperature) {}
+    virtual void foldTo(const biopp::NucSequence&, const bool, biopp::SecStructure&, const FilePath&, IMotifObserver*, const Temperature) {}
+    virtual Fe foldFrom(const FilePath&, biopp::SecStructure&)
+    {
+        return 0;
+    }
+    virtual Fe foldFrom(const FilePath&, biopp::SecStructure&, IMotifObserver*)
+    {
+        return 0;
+    }
+    virtual Fe foldEnergy(const biopp::NucSequence& seqRNAm, const bool, const Temperature)
+    {
+        return -Fe(seqRNAm.length());
+    }
+    virtual void foldLazy(const biopp::NucSequence& seqRNAm, const bool isCircRNAm, FoldResult& result, const Temperature)
+    {
+        PackedStructure packed;
+        packed.pack(std::string(seqRNAm.length(), '.'));
+        result.assign(-Fe(seqRNAm.length()), isCircRNAm, packed);
+    }
+};
+
+REGISTER_FACTORIZABLE_CLASS(IFold, FakeFold, std::string, "FakeFold");
+
+struct CollectObserver : public IFoldResultObserver
+{
+    virtual void processFold(const FastaRecord& record, const Fe freeEnergy, const biopp::SecStructure& structure)
+    {
+        EXPECT_EQ(structure.size(), record.sequence.size());
+        EXPECT_TRUE(structure.is_circular());
+        EXPECT_DOUBLE_EQ(freeEnergy, -Fe(record.sequence.size()));
+        indexes.insert(record.index);
+    }
+
+    std::set<size_t> indexes;
+};
+
+TEST(FastaPipelineTestSuite, FoldPipeline)
+{
+    static const size_t SEQUENCES = 100;
+    {
+        std::ofstream out(FASTA_FILE.c_str());
+        for (size_t i = 0; i < SEQUENCES; ++i)
+        {
+            out << ">seq" << i << "\n" << std::string(i % 7 + 1, 'A') << "\n";
+        }
+    }
+    FastaPipelineParams params;
+    params.workers = 3;
+    params.batchSize = 8;
+    params.queueCapacity = 2;
+    params.circular = true;
+    CollectObserver observer;
+    foldFasta(FASTA_FILE, "FakeFold", params, observer);
+    EXPECT_EQ(observer.indexes.size(), SEQUENCES);
+    unlink(FASTA_FILE.c_str());
+    EXPECT_FALSE(HelperTest::checkDirTmp());
+}
+
+TEST(FastaPipelineTestSuite, InvalidBackend)
+{
+    writeFasta(FASTA_FILE);
+    FastaPipelineParams params;
+    CollectObserver observer;
+    EXPECT_THROW(foldFasta(FASTA_FILE, "NotABackend", params, observer), InvalidDerived);
+    unlink(FASTA_FILE.c_str());
+}
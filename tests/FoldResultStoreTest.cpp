@@ -0,0 +1,231 @@
+/*
+ * @file      FoldResultStoreTest.cpp
+ * @brief     RNAFoldTest is a test file to the binary result store.
+ *
+ * @author    Franco Riberi
+ * @email     fgriberi AT gmail.com
+ *
+ * Contents:  Source file.
+ *
+ * System:    fideo: Folding Interface Dynamic Exchange Operations
+ * Language:  C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo.
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <fstream>
+#include <biopp/biopp.h>
+#include <gtest/gtest.h>
+#include "fideo/FoldResultStore.h"
+#include "fideo/FideoStructureParser.h"
+#include "HelperTest.h"
+
+using namespace fideo;
+
+static const FilePath STORE_FILE = "/tmp/fideo-store.test";
+
+static void removeStore()
+{
+    unlink(STORE_FILE.c_str());
+    unlink((STORE_FILE + FoldResultStoreFormat::INDEX_SUFFIX).c_str());
+}
+
+static void fillRecord(const std::string& id, const std::string& structure, const Fe energy, FoldRecord& record)
+{
+    record.sequenceId = id;
+    record.backend = "RNAFold";
+    record.temperature = 37;
+    record.energy = energy;
+    record.circular = false;
+    record.structure.pack(structure);
+}
+
+TEST(FoldResultStoreTestSuite, PackedStructureRoundTrip)
+{
+    biopp::SecStructure structure;
+    ViennaParser::parseStructure("..((((((((((((....)))))))))))).", structure);
+    PackedStructure packed;
+    packed.pack(structure);
+    EXPECT_EQ(packed.size(), structure.size());
+    EXPECT_EQ(packed.bytes().size(), PackedStructure::bytesFor(structure.size()));
+
+    biopp::SecStructure unpacked;
+    packed.unpack(unpacked);
+    std::string str;
+    ViennaParser::toString(unpacked, str);
+    EXPECT_EQ(str, "..((((((((((((....)))))))))))).");
+}
+
+TEST(FoldResultStoreTestSuite, InvalidPackedStructure)
+{
+    PackedStructure packed;
+    EXPECT_THROW(packed.pack("..((x))"), InvalidStructureException);
+    packed.pack("..))((..");
+    biopp::SecStructure structure;
+    EXPECT_THROW(packed.unpack(structure), InvalidStructureException);
+}
+
+TEST(FoldResultStoreTestSuite, WriteAndRead)
+{
+    removeStore();
+    {
+        FoldResultWriter writer(STORE_FILE);
+        FoldRecord record;
+        fillRecord("seq-1", "((((....))))", -4.5, record);
+        writer.append(record);
+        fillRecord("seq-2", "..((...)).", -1.2, record);
+        record.circular = true;
+        record.temperature = 40;
+        writer.append(record);
+    }
+
+    FoldResultReader reader(STORE_FILE);
+    ASSERT_EQ(reader.size(), 2);
+    EXPECT_DOUBLE_EQ(reader.energy(0), -4.5);
+    EXPECT_DOUBLE_EQ(reader.energy(1), -1.2);
+
+    FoldRecord record;
+    reader.read(1, record);
+    EXPECT_EQ(record.sequenceId, "seq-2");
+    EXPECT_EQ(record.backend, "RNAFold");
+    EXPECT_DOUBLE_EQ(record.temperature, 40);
+    EXPECT_TRUE(record.circular);
+    std::string str;
+    record.structure.toString(str);
+    EXPECT_EQ(str, "..((...)).");
+    EXPECT_THROW(reader.read(2, record), IndexOutOfRange);
+    removeStore();
+    EXPECT_FALSE(HelperTest::checkDirTmp());
+}
+
+TEST(FoldResultStoreTestSuite, AppendToExistingStore)
+{
+    removeStore();
+    FoldRecord record;
+    fillRecord("seq-1", "((....))", -2, record);
+    {
+        FoldResultWriter writer(STORE_FILE);
+        writer.append(record);
+    }
+    {
+        FoldResultWriter writer(STORE_FILE);
+        fillRecord("seq-2", "........", 0, record);
+        writer.append(record);
+    }
+    FoldResultReader reader(STORE_FILE);
+    ASSERT_EQ(reader.size(), 2);
+    reader.read(0, record);
+    EXPECT_EQ(record.sequenceId, "seq-1");
+    reader.read(1, record);
+    EXPECT_EQ(record.sequenceId, "seq-2");
+    removeStore();
+}
+
+TEST(FoldResultStoreTestSuite, TornIndexTailIsIgnored)
+{
+    removeStore();
+    {
+        FoldResultWriter writer(STORE_FILE);
+        FoldRecord record;
+        fillRecord("seq-1", "((....))", -2, record);
+        writer.append(record);
+    }
+    {
+        std::ofstream index((STORE_FILE + FoldResultStoreFormat::INDEX_SUFFIX).c_str(), std::ios::binary | std::ios::app);
+        index << "partial entry";
+    }
+    FoldResultReader reader(STORE_FILE);
+    EXPECT_EQ(reader.size(), 1);
+    removeStore();
+}
+
+TEST(FoldResultStoreTestSuite, AppendAfterTornTails)
+{
+    removeStore();
+    FoldRecord record;
+    {
+        FoldResultWriter writer(STORE_FILE);
+        fillRecord("seq-1", "((....))", -2, record);
+        writer.append(record);
+        fillRecord("seq-2", "(......)", -1, record);
+        writer.append(record);
+    }
+    {
+        //a crash left the last record torn, a partial entry and data with no entry.
+        std::fstream data(STORE_FILE.c_str(), std::ios::binary | std::ios::in | std::ios::out);
+        data.seekp(-1, std::ios::end);
+        data << "X";
+        data.seekp(0, std::ios::end);
+        data << "record with no entry";
+        std::ofstream index((STORE_FILE + FoldResultStoreFormat::INDEX_SUFFIX).c_str(), std::ios::binary | std::ios::app);
+        index << "partial entry";
+    }
+    {
+        FoldResultWriter writer(STORE_FILE);
+        fillRecord("seq-3", "........", 0, record);
+        writer.append(record);
+        fillRecord("seq-4", "((.()))", -3, record);
+        writer.append(record);
+    }
+    FoldResultReader reader(STORE_FILE);
+    ASSERT_EQ(reader.size(), 3);
+    reader.read(0, record);
+    EXPECT_EQ(record.sequenceId, "seq-1");
+    reader.read(1, record);
+    EXPECT_EQ(record.sequenceId, "seq-3");
+    reader.read(2, record);
+    EXPECT_EQ(record.sequenceId, "seq-4");
+    EXPECT_EQ(record.energy, -3);
+    removeStore();
+}
+
+TEST(FoldResultStoreTestSuite, CorruptedRecord)
+{
+    removeStore();
+    {
+        FoldResultWriter writer(STORE_FILE);
+        FoldRecord record;
+        fillRecord("seq-1", "((....))", -2, record);
+        writer.append(record);
+    }
+    {
+        std::fstream data(STORE_FILE.c_str(), std::ios::binary | std::ios::in | std::ios::out);
+        data.seekp(sizeof(FoldResultStoreFormat::FileHeader) + sizeof(FoldResultStoreFormat::RecordHeader));
+        data << "X";
+    }
+    FoldResultReader reader(STORE_FILE);
+    FoldRecord record;
+    EXPECT_THROW(reader.read(0, record), CorruptedResultRecord);
+    removeStore();
+}
+
+TEST(FoldResultStoreTestSuite, InvalidStore)
+{
+    removeStore();
+    {
+        std::ofstream data(STORE_FILE.c_str());
+        data << "this is not a fideo result store";
+    }
+    EXPECT_THROW(FoldResultWriter writer(STORE_FILE), InvalidResultStore);
+    EXPECT_THROW(FoldResultReader reader(STORE_FILE), InvalidResultStore);
+    removeStore();
+    EXPECT_FALSE(HelperTest::checkDirTmp());
+}
@@ -1,3 +1,7 @@
+#include <cstdlib>
+#include <fstream>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <mili/mili.h>
@@ -123,3 +127,50 @@ TEST_F(INFORNATest, BadStart3)
 
     delete inverse;
 }
+
+TEST_F(INFORNATest, ReadsEveryDesign)
+{
+    //an INFO-RNA stand-in printing two designs, first in the PATH.
+    const std::string dir = "/tmp/fideo-inforna-bin";
+    const std::string program = dir + "/INFO-RNA-2.1.2";
+    const std::string runs = dir + "/runs";
+    mkdir(dir.c_str(), 0755);
+    unlink(runs.c_str());
+    {
+        std::ofstream script(program.c_str());
+        script << "echo run >> " << runs << "\n"
+               << "for s in GUAGCUUUAUGCCGC GCAGCCGUAUGCCGC; do\n"
+               << "echo '========================='\n"
+               << "echo 'Local Search Results:'\n"
+               << "echo '========================='\n"
+               << "echo \"MFE:    $s    3  (-1.70)   d= 1\"\n"
+               << "echo 'number of mismatches: 0'\n"
+               << "done\n";
+    }
+    chmod(program.c_str(), 0755);
+    const std::string path = getenv("PATH");
+    setenv("PATH", (dir + ":" + path).c_str(), 1);
+
+    IFoldInverse* const inverse = IFoldInverse::factory("INFORNA", InverseFoldParams(str, 4, 5, 10, 1, 2));
+    inverse->set_start(NucSequence("GCACGCGTATGCCGC"));
+    NucSequence first;
+    NucSequence second;
+    inverse->fold_inverse(first);
+    inverse->fold_inverse(second);
+    delete inverse;
+    setenv("PATH", path.c_str(), 1);
+
+    EXPECT_EQ("guagcuuuaugccgc", first.getString());
+    EXPECT_EQ("gcagccguaugccgc", second.getString());
+    std::ifstream counter(runs.c_str());
+    std::string line;
+    size_t count = 0;
+    while (std::getline(counter, line))
+    {
+        ++count;
+    }
+    EXPECT_EQ(1u, count);
+    unlink(runs.c_str());
+    unlink(program.c_str());
+    rmdir(dir.c_str());
+}
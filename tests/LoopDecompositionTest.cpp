@@ -0,0 +1,158 @@
+/*
+ * @file      LoopDecompositionTest.cpp
+ * @brief     Loop decomposition tests.
+ *
+ * @author    Franco Riberi
+ * @email     fgriberi AT gmail.com
+ *
+ * Contents:  Source file.
+ *
+ * System:    fideo: Folding Interface Dynamic Exchange Operations
+ * Language:  C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo.
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <vector>
+#include <biopp/biopp.h>
+#include <gtest/gtest.h>
+#include "fideo/LoopDecomposition.h"
+#include "fideo/FideoStructureParser.h"
+
+using namespace fideo;
+
+struct MotifRecorder : public IMotifObserver
+{
+    virtual void start()
+    {}
+
+    virtual void processMotif(const Motif& motif)
+    {
+        motifs.push_back(motif);
+    }
+
+    virtual void finalize()
+    {}
+
+    void expect(const size_t index, const std::string& name, const size_t attribute, const size_t stacks) const
+    {
+        ASSERT_LT(index, motifs.size());
+        EXPECT_EQ(name, motifs[index].nameMotif);
+        EXPECT_EQ(attribute, motifs[index].attribute);
+        EXPECT_EQ(stacks, motifs[index].amountStacks);
+    }
+
+    std::vector<Motif> motifs;
+};
+
+static void decompose(const std::string& dotBracket, MotifRecorder& recorder)
+{
+    biopp::SecStructure structure;
+    ViennaParser::parseStructure(dotBracket, structure);
+    decomposeLoops(structure, recorder);
+}
+
+TEST(LoopDecompositionTest, Hairpin)
+{
+    MotifRecorder recorder;
+    decompose("..((((....))))..", recorder);
+
+    ASSERT_EQ(2u, recorder.motifs.size());
+    recorder.expect(0, EXTERNAL_LOOP, 4, 3);
+    recorder.expect(1, HAIRPIN_LOOP, 5, 0);
+}
+
+TEST(LoopDecompositionTest, InteriorLoopsAndBulges)
+{
+    MotifRecorder recorder;
+    decompose("(((....((((((((((...))))))))).)....)))", recorder);
+
+    ASSERT_EQ(4u, recorder.motifs.size());
+    recorder.expect(0, EXTERNAL_LOOP, 0, 2);
+    recorder.expect(1, SYMMETRIC, 5, 0);
+    recorder.expect(2, BULGE_LOOP, 2, 8);
+    recorder.expect(3, HAIRPIN_LOOP, 4, 0);
+
+    MotifRecorder other;
+    decompose("((...((....))..))", other);
+    ASSERT_EQ(3u, other.motifs.size());
+    other.expect(1, ASYMMETRIC, 4, 1);
+
+    MotifRecorder bulge;
+    decompose("((...((....))))", bulge);
+    ASSERT_EQ(3u, bulge.motifs.size());
+    bulge.expect(1, BULGE_LOOP, 4, 1);
+}
+
+//the structure of fileToParse.det: same loops as UNAFold reports.
+TEST(LoopDecompositionTest, SameLoopsAsUNAFold)
+{
+    MotifRecorder recorder;
+    decompose(".((((.......((((...)))).........(((((.((((....)))).(((.(((((((((...((((..(((................(((((...(((.....)))....)))))"
+              "....(((((((..(((...((((.....))))...)))..))))))))))..))))...))))).)))).))).))))).))))", recorder);
+
+    ASSERT_EQ(15u, recorder.motifs.size());
+    recorder.expect(0, EXTERNAL_LOOP, 1, 3);
+    recorder.expect(1, MULTI_LOOP, 17, 7);
+    recorder.expect(2, HAIRPIN_LOOP, 4, 0);
+    recorder.expect(3, MULTI_LOOP, 3, 5);
+    recorder.expect(4, HAIRPIN_LOOP, 5, 0);
+    recorder.expect(5, SYMMETRIC, 2, 3);
+    recorder.expect(6, BULGE_LOOP, 2, 4);
+    recorder.expect(7, SYMMETRIC, 4, 3);
+    recorder.expect(8, SYMMETRIC, 3, 2);
+    recorder.expect(9, MULTI_LOOP, 20, 10);
+    recorder.expect(10, ASYMMETRIC, 5, 2);
+    recorder.expect(11, HAIRPIN_LOOP, 6, 0);
+    recorder.expect(12, SYMMETRIC, 3, 2);
+    recorder.expect(13, SYMMETRIC, 4, 3);
+    recorder.expect(14, HAIRPIN_LOOP, 6, 0);
+}
+
+TEST(LoopDecompositionTest, Unpaired)
+{
+    MotifRecorder recorder;
+    decompose("........", recorder);
+
+    ASSERT_EQ(1u, recorder.motifs.size());
+    recorder.expect(0, EXTERNAL_LOOP, 8, 0);
+}
+
+TEST(LoopDecompositionTest, Records)
+{
+    biopp::SecStructure structure;
+    ViennaParser::parseStructure("((...((....))..)).", structure);
+    std::vector<MotifRecord> records;
+    decomposeLoops(structure, records);
+
+    ASSERT_EQ(3u, records.size());
+    EXPECT_EQ(MotifExternalLoop, records[0].kind);
+    EXPECT_EQ(0u, records[0].first);
+    EXPECT_EQ(17u, records[0].last);
+    EXPECT_EQ(1u, records[0].attribute);
+    EXPECT_EQ(MotifInteriorAsymmetric, records[1].kind);
+    EXPECT_EQ(1u, records[1].first);
+    EXPECT_EQ(15u, records[1].last);
+    EXPECT_EQ(MotifHairpinLoop, records[2].kind);
+    EXPECT_EQ(6u, records[2].first);
+    EXPECT_EQ(11u, records[2].last);
+    EXPECT_EQ(5u, records[2].attribute);
+}
@@ -0,0 +1,158 @@
+/*
+ * @file      MotifHistogramTest.cpp
+ * @brief     Motif histogram tests.
+ *
+ * @author    Franco Riberi
+ * @email     fgriberi AT gmail.com
+ *
+ * Contents:  Source file.
+ *
+ * System:    fideo: Folding Interface Dynamic Exchange Operations
+ * Language:  C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo.
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <thread>
+#include <vector>
+#include <biopp/biopp.h>
+#include <gtest/gtest.h>
+#include "fideo/MotifHistogram.h"
+#include "fideo/LoopDecomposition.h"
+#include "fideo/FideoStructureParser.h"
+#include "fideo/RnaBackendsException.h"
+
+using namespace fideo;
+
+static void count(const std::string& dotBracket, MotifHistogram& histogram)
+{
+    biopp::SecStructure structure;
+    ViennaParser::parseStructure(dotBracket, structure);
+    decomposeLoops(structure, histogram);
+}
+
+TEST(MotifHistogramTest, CountsRecords)
+{
+    MotifHistogram histogram(8, 4);
+    count("(((....((((((((((...))))))))).)....)))", histogram);
+    count("..((((....))))..", histogram);
+
+    EXPECT_EQ(2u, histogram.structures());
+    EXPECT_EQ(2u, histogram.motifs(MotifExternalLoop));
+    EXPECT_EQ(2u, histogram.motifs(MotifHairpinLoop));
+    EXPECT_EQ(1u, histogram.motifs(MotifBulgeLoop));
+    EXPECT_EQ(1u, histogram.motifs(MotifInteriorSymmetric));
+    EXPECT_EQ(0u, histogram.motifs(MotifMultiLoop));
+    EXPECT_EQ(1u, histogram.attributes(MotifHairpinLoop, 4));
+    EXPECT_EQ(1u, histogram.attributes(MotifHairpinLoop, 5));
+    EXPECT_EQ(1u, histogram.attributes(MotifExternalLoop, 0));
+    EXPECT_EQ(1u, histogram.attributes(MotifExternalLoop, 4));
+    //8 stacks go to the last bin.
+    EXPECT_EQ(1u, histogram.stacks(MotifBulgeLoop, 3));
+    //the outer helices have 3 and 4 pairs.
+    EXPECT_EQ(0u, histogram.stacks(MotifExternalLoop, 0));
+    EXPECT_EQ(0u, histogram.stacks(MotifExternalLoop, 1));
+    EXPECT_EQ(1u, histogram.stacks(MotifExternalLoop, 2));
+    EXPECT_EQ(1u, histogram.stacks(MotifExternalLoop, 3));
+}
+
+TEST(MotifHistogramTest, CountsMotifs)
+{
+    MotifHistogram histogram;
+    IMotifObserver::Motif motif;
+    motif.nameMotif = MULTI_LOOP;
+    motif.attribute = 17;
+    motif.amountStacks = 4;
+    histogram.processMotif(motif);
+
+    EXPECT_EQ(1u, histogram.motifs(MotifMultiLoop));
+    EXPECT_EQ(1u, histogram.attributes(MotifMultiLoop, 17));
+    EXPECT_EQ(1u, histogram.stacks(MotifMultiLoop, 4));
+
+    motif.nameMotif = INTERIOR_LOOP;
+    EXPECT_THROW(histogram.processMotif(motif), InvalidMotif);
+}
+
+static void countMany(MotifHistogram* histogram, const size_t structures)
+{
+    for (size_t i = 0; i < structures; ++i)
+    {
+        count("((...((....))..))", *histogram);
+    }
+}
+
+TEST(MotifHistogramTest, MergesThreadPartials)
+{
+    const size_t threads = 4;
+    const size_t structures = 100;
+    std::vector<MotifHistogram> partials(threads, MotifHistogram(16, 16));
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < threads; ++i)
+    {
+        workers.push_back(std::thread(countMany, &partials[i], structures));
+    }
+    MotifHistogram total(16, 16);
+    for (size_t i = 0; i < threads; ++i)
+    {
+        workers[i].join();
+        total.merge(partials[i]);
+    }
+
+    EXPECT_EQ(threads * structures, total.structures());
+    EXPECT_EQ(threads * structures, total.motifs(MotifInteriorAsymmetric));
+    EXPECT_EQ(threads * structures, total.attributes(MotifInteriorAsymmetric, 4));
+    EXPECT_EQ(threads * structures, total.stacks(MotifInteriorAsymmetric, 1));
+
+    total.clear();
+    EXPECT_EQ(0u, total.structures());
+    EXPECT_EQ(0u, total.motifs(MotifHairpinLoop));
+    EXPECT_THROW(total.merge(MotifHistogram(8, 16)), RNABackendException);
+}
+
+TEST(MotifHistogramTest, CountsStructuresOncePerRecords)
+{
+    MotifHistogram histogram;
+    MotifRecord record = {1, 10, 4, 1, MotifHairpinLoop};
+    histogram.processMotifs(&record, &record + 1);
+    histogram.finalize();
+    histogram.processMotifs(&record, &record);
+
+    EXPECT_EQ(2u, histogram.structures());
+    EXPECT_EQ(1u, histogram.motifs(MotifHairpinLoop));
+}
+
+TEST(MotifHistogramTest, RejectsUnknownKind)
+{
+    MotifHistogram histogram;
+    MotifRecord record = {1, 10, 4, 1, MotifKinds};
+    EXPECT_THROW(histogram.processMotifs(&record, &record + 1), InvalidMotif);
+    EXPECT_EQ(0u, histogram.motifs(MotifHairpinLoop));
+}
+
+TEST(MotifHistogramTest, KindsHaveTheMotifNames)
+{
+    EXPECT_EQ(EXTERNAL_LOOP, motifName(MotifExternalLoop));
+    EXPECT_EQ(HAIRPIN_LOOP, motifName(MotifHairpinLoop));
+    EXPECT_EQ(BULGE_LOOP, motifName(MotifBulgeLoop));
+    EXPECT_EQ(SYMMETRIC, motifName(MotifInteriorSymmetric));
+    EXPECT_EQ(ASYMMETRIC, motifName(MotifInteriorAsymmetric));
+    EXPECT_EQ(MULTI_LOOP, motifName(MotifMultiLoop));
+}
@@ -0,0 +1,104 @@
+/*
+ * @file      RNAFoldOutputParserTest.cpp
+ * @brief     RNAFoldTest is a test file to the RNAfold output parser.
+ *
+ * @author    Franco Riberi
+ * @email     fgriberi AT gmail.com
+ *
+ * Contents:  Source file.
+ *
+ * System:    fideo: Folding Interface Dynamic Exchange Operations
+ * Language:  C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo.
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <fstream>
+#include <gtest/gtest.h>
+#include "fideo/RNAFoldOutputParser.h"
+
+using namespace fideo;
+
+TEST(RNAFoldOutputParserTestSuite, SingleRecord)
+{
+    const std::string output = "AAAAAAAAGGGGGGGGCCCCCCCCUUUUUUUU\n"
+                               "..((((((((((((....)))))))))))).. (-13.60)\n";
+    RNAFoldOutputParser parser(output.data(), output.data() + output.size());
+    RNAFoldRecord record;
+    ASSERT_TRUE(parser.next(record));
+    EXPECT_TRUE(record.name.empty());
+    EXPECT_EQ(record.sequence, "AAAAAAAAGGGGGGGGCCCCCCCCUUUUUUUU");
+    EXPECT_EQ(record.structure, "..((((((((((((....))))))))))))..");
+    EXPECT_DOUBLE_EQ(record.energy, -13.6);
+    EXPECT_FALSE(parser.next(record));
+}
+
+TEST(RNAFoldOutputParserTestSuite, MultipleRecords)
+{
+    const std::string output = ">first\n"
+                               "GGGGAAAACCCC\n"
+                               "((((....)))) ( -1.20)\n"
+                               " ((((....)))) [ -1.50]\n"
+                               " ((((....)))) { -1.20 d=0.52}\n"
+                               " frequency of mfe structure in ensemble 0.6; ensemble diversity 0.93\n"
+                               ">second\n"
+                               "AAAA\n"
+                               ".... (  0.00)";
+    RNAFoldOutputParser parser(output.data(), output.data() + output.size());
+    RNAFoldRecord record;
+    ASSERT_TRUE(parser.next(record));
+    EXPECT_EQ(record.name, "first");
+    EXPECT_EQ(record.structure, "((((....))))");
+    EXPECT_DOUBLE_EQ(record.energy, -1.2);
+    ASSERT_TRUE(parser.next(record));
+    EXPECT_EQ(record.name, "second");
+    EXPECT_EQ(record.sequence, "AAAA");
+    EXPECT_DOUBLE_EQ(record.energy, 0);
+    EXPECT_FALSE(parser.next(record));
+}
+
+TEST(RNAFoldOutputParserTestSuite, EnergyOnly)
+{
+    const std::string output = "GGGGAAAACCCC\n((((....)))) ( -1.20)\nAAAA\n.... (  0.00)\n";
+    RNAFoldOutputParser parser(output.data(), output.data() + output.size());
+    Fe energy;
+    ASSERT_TRUE(parser.nextEnergy(energy));
+    EXPECT_DOUBLE_EQ(energy, -1.2);
+    ASSERT_TRUE(parser.nextEnergy(energy));
+    EXPECT_DOUBLE_EQ(energy, 0);
+    EXPECT_FALSE(parser.nextEnergy(energy));
+}
+
+TEST(RNAFoldOutputParserTestSuite, InvalidOutput)
+{
+    RNAFoldRecord record;
+    const std::string noStructure = "GGGGAAAACCCC\n";
+    RNAFoldOutputParser parser1(noStructure.data(), noStructure.data() + noStructure.size());
+    EXPECT_THROW(parser1.next(record), RNABackendException);
+
+    const std::string noEnergy = "GGGGAAAACCCC\n((((....))))\n";
+    RNAFoldOutputParser parser2(noEnergy.data(), noEnergy.data() + noEnergy.size());
+    EXPECT_THROW(parser2.next(record), RNABackendException);
+
+    const std::string badEnergy = "GGGGAAAACCCC\n((((....)))) (abc)\n";
+    RNAFoldOutputParser parser3(badEnergy.data(), badEnergy.data() + badEnergy.size());
+    EXPECT_THROW(parser3.next(record), RNABackendException);
+}
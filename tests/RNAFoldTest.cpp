@@ -111,28 +111,93 @@ TEST(RNAFoldBackendTestSuite1, FoldFromTest)
     EXPECT_FALSE(HelperTest::checkDirTmp());    
 }
 
-TEST(RNAFoldBackendTestSuite1, InvalidBackend)
+TEST(RNAFoldBackendTestSuite1, FoldEnergyTest)
 {
-    IFold* const rnafold = Fold::new_class("RNAfold");    
-    ASSERT_TRUE(rnafold == NULL);
-    delete rnafold;
+    const biopp::NucSequence seq("AATTAAAAAAGGGGGGGTTGCAACCCCCCCTTTTTTTT");
+
+    IFold* const p = Fold::new_class("RNAFold");
+    ASSERT_TRUE(p != NULL);
+
+    EXPECT_DOUBLE_EQ(p->foldEnergy(seq, true), -18.70);
+    EXPECT_DOUBLE_EQ(p->foldEnergy(seq, true, 38.5), -18.10);
+    delete p;
+    EXPECT_FALSE(HelperTest::checkDirTmp());
+}
+
+TEST(RNAFoldBackendTestSuite1, FoldLazyTest)
+{
+    const biopp::NucSequence seq("AATTAAAAAAGGGGGGGTTGCAACCCCCCCTTTTTTTT");
+    biopp::SecStructure expected;
+
+    IFold* const p = Fold::new_class("RNAFold");
+    ASSERT_TRUE(p != NULL);
+
+    FoldResult result;
+    p->foldLazy(seq, true, result);
+    const Fe freeEnergy = p->fold(seq, true, expected);
+    delete p;
+
+    EXPECT_DOUBLE_EQ(result.energy(), freeEnergy);
+    EXPECT_FALSE(result.decoded());
+    const biopp::SecStructure& structure = result.structure();
+    EXPECT_TRUE(result.decoded());
+    EXPECT_TRUE(structure.is_circular());
+    ASSERT_EQ(expected.size(), structure.size());
+    for (biopp::SeqIndex i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_EQ(expected.is_paired(i), structure.is_paired(i));
+    }
+    EXPECT_FALSE(HelperTest::checkDirTmp());
 }
 
-TEST(RNAFoldBackendTestSuite1, getSizeOfSequence)
+struct MotifCounter : public IMotifObserver
+{
+    MotifCounter() : finalized(0) {}
+
+    virtual void start() {}
+
+    virtual void processMotif(const Motif& motif)
+    {
+        names.push_back(motif.nameMotif);
+    }
+
+    virtual void finalize()
+    {
+        ++finalized;
+    }
+
+    std::vector<std::string> names;
+    size_t finalized;
+};
+
+TEST(RNAFoldBackendTestSuite1, FoldWithObserverTest)
 {
-    const biopp::NucSequence seq("AATTAAAAAAGGGGGGGTTGCAACCCCCCCTTTTTTTTCCCCCCCCTCCATTTTTTTTT");
+    const biopp::NucSequence seq("GGGGAAACCCCATAGGGAAACCCTATGGGCGAAAGCCC");
     biopp::SecStructure secStructure;
-    RNAFold rnafold;
-    InputFile inFile;
-    OutputFile outFile;    
-    etilico::Command cmd;
-    rnafold.prepareData(seq, true, cmd, inFile, outFile);   
-    etilico::runCommand(cmd);
 
-    EXPECT_EQ(rnafold.getSizeOfSequence(outFile), seq.length());
-    unlink(inFile.c_str());
-    unlink(outFile.c_str());
-    EXPECT_FALSE(HelperTest::checkDirTmp());    
+    IFold* const p = Fold::new_class("RNAFold");
+    ASSERT_TRUE(p != NULL);
+
+    MotifCounter observer;
+    const Fe result = p->fold(seq, false, secStructure, &observer);
+    delete p;
+
+    //(((....((((((((((...))))))))).)....)))
+    EXPECT_DOUBLE_EQ(result, -19.20);
+    ASSERT_EQ(4u, observer.names.size());
+    EXPECT_EQ(EXTERNAL_LOOP, observer.names[0]);
+    EXPECT_EQ(SYMMETRIC, observer.names[1]);
+    EXPECT_EQ(BULGE_LOOP, observer.names[2]);
+    EXPECT_EQ(HAIRPIN_LOOP, observer.names[3]);
+    EXPECT_EQ(1u, observer.finalized);
+    EXPECT_FALSE(HelperTest::checkDirTmp());
+}
+
+TEST(RNAFoldBackendTestSuite1, InvalidBackend)
+{
+    IFold* const rnafold = Fold::new_class("RNAfold");    
+    ASSERT_TRUE(rnafold == NULL);
+    delete rnafold;
 }
 
 TEST(RNAFoldBackendTestSuite2, correctCommad1)
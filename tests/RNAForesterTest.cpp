@@ -14,4 +14,68 @@ TEST(RNAForesterTest, Compare)
 
     EXPECT_EQ(forester->compare(s1, s2), -1.4f);
     delete forester;
-}
\ No newline at end of file
+}
+
+TEST(RNAForesterTest, ProfileCompareAll)
+{
+    fideo::IStructureCmp* forester = fideo::IStructureCmp::Factory::new_class("RNAForesterProfile");
+    const char* const dotBrackets[] = {"((..((...))..))", "(((....)))......", "(((...)))..(((...)))", "..((((....))))......"};
+    std::vector<biopp::SecStructure> structures(4);
+    for (size_t i = 0; i < structures.size(); ++i)
+    {
+        fideo::ViennaParser::parseStructure(dotBrackets[i], structures[i]);
+    }
+
+    std::vector<fideo::Similitude> upper;
+    forester->compareAll(structures, upper);
+
+    //scores of the multiple alignment mode, by rows of the upper triangle.
+    ASSERT_EQ(6u, upper.size());
+    EXPECT_NEAR(-1.85714, upper[0], 1e-5);
+    EXPECT_NEAR(-2.4, upper[1], 1e-5);
+    EXPECT_NEAR(-1.25, upper[2], 1e-5);
+    EXPECT_NEAR(-1.0, upper[3], 1e-5);
+    EXPECT_NEAR(-0.428571, upper[4], 1e-5);
+    EXPECT_NEAR(-1.4, upper[5], 1e-5);
+    delete forester;
+}
+
+TEST(RNAForesterTest, ProfileCompareMatchesCompareAll)
+{
+    fideo::IStructureCmp* forester = fideo::IStructureCmp::Factory::new_class("RNAForesterProfile");
+    const char* const dotBrackets[] = {"((..((...))..))", "(((....)))......", "(((...)))..(((...)))"};
+    std::vector<biopp::SecStructure> structures(3);
+    for (size_t i = 0; i < structures.size(); ++i)
+    {
+        fideo::ViennaParser::parseStructure(dotBrackets[i], structures[i]);
+    }
+
+    std::vector<fideo::Similitude> upper;
+    forester->compareAll(structures, upper);
+
+    ASSERT_EQ(3u, upper.size());
+    EXPECT_EQ(upper[0], forester->compare(structures[0], structures[1]));
+    EXPECT_EQ(upper[1], forester->compare(structures[0], structures[2]));
+    EXPECT_EQ(upper[2], forester->compare(structures[1], structures[2]));
+    delete forester;
+}
+
+TEST(RNAForesterTest, CompareAllMatchesCompare)
+{
+    fideo::IStructureCmp* forester = fideo::IStructureCmp::Factory::new_class("RNAForester");
+    const char* const dotBrackets[] = {"((....))", "(...)...", "(((...)))."};
+    std::vector<biopp::SecStructure> structures(3);
+    for (size_t i = 0; i < structures.size(); ++i)
+    {
+        fideo::ViennaParser::parseStructure(dotBrackets[i], structures[i]);
+    }
+
+    std::vector<fideo::Similitude> upper;
+    forester->compareAll(structures, upper);
+
+    ASSERT_EQ(3u, upper.size());
+    EXPECT_EQ(forester->compare(structures[0], structures[1]), upper[0]);
+    EXPECT_EQ(forester->compare(structures[0], structures[2]), upper[1]);
+    EXPECT_EQ(forester->compare(structures[1], structures[2]), upper[2]);
+    delete forester;
+}
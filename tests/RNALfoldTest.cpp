@@ -0,0 +1,83 @@
+/*
+ * @file      RNALfoldTest.cpp
+ * @brief     RNALfoldTest is a test file to the local folding backend.
+ *
+ * @author    Franco Riberi
+ * @email     fgriberi AT gmail.com
+ *
+ * Contents:  Source file.
+ *
+ * System:    fideo: Folding Interface Dynamic Exchange Operations
+ * Language:  C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo.
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <biopp/biopp.h>
+#include <gtest/gtest.h>
+#include "fideo/ILocalFold.h"
+#include "fideo/RnaBackendsException.h"
+
+static const std::string LONG_SEQUENCE = "GGGGAAACCCCAUAGGGAAACCCUAUGGGCGAAAGCCCAAAAUUUUGCGCGCAAAAGCGCGCAAAAUUUU";
+
+TEST(RNALfoldTest, FoldLocal)
+{
+    fideo::ILocalFold* const folder = fideo::ILocalFold::Factory::new_class("RNALfold");
+    ASSERT_TRUE(folder != NULL);
+    const biopp::NucSequence sequence(LONG_SEQUENCE);
+    std::vector<fideo::LocalStructure> structures;
+    const fideo::Fe energy = folder->foldLocal(sequence, 30, structures);
+    EXPECT_NEAR(-38.9, energy, 1e-5);
+
+    ASSERT_EQ(5u, structures.size());
+    const size_t starts[] = {0, 7, 11, 24, 38};
+    const fideo::Fe energies[] = {-5.6, -15.5, -4.9, -9.3, -19.1};
+    for (size_t i = 0; i < structures.size(); ++i)
+    {
+        EXPECT_EQ(starts[i], structures[i].start);
+        EXPECT_NEAR(energies[i], structures[i].energy, 1e-5);
+    }
+    std::string dotBracket;
+    structures[4].structure.toString(dotBracket);
+    EXPECT_EQ(".(((((((((((((....))))))))))))).", dotBracket);
+    structures[0].structure.toString(dotBracket);
+    EXPECT_EQ("((((...)))).", dotBracket);
+    delete folder;
+}
+
+TEST(RNALfoldTest, PairingProbabilities)
+{
+    fideo::ILocalFold* const folder = fideo::ILocalFold::Factory::new_class("RNALfold");
+    const biopp::NucSequence sequence(LONG_SEQUENCE);
+    std::vector<fideo::Probability> paired;
+    folder->pairingProbabilities(sequence, 40, 30, paired);
+    ASSERT_EQ(LONG_SEQUENCE.size(), paired.size());
+    for (size_t i = 0; i < paired.size(); ++i)
+    {
+        EXPECT_LE(0.0, paired[i]);
+        EXPECT_GE(1.0, paired[i]);
+    }
+    //the loop AAA of the first hairpin is unpaired, its stem paired.
+    EXPECT_GT(paired[1], 0.9);
+    EXPECT_LT(paired[5], 0.05);
+    EXPECT_THROW(folder->pairingProbabilities(sequence, 20, 30, paired), fideo::InvalidWindow);
+    delete folder;
+}
@@ -0,0 +1,374 @@
+/*
+ * @file      RNAStartInverseTest.cpp
+ * @brief     RNAStartInverseTest is a test file to the parallel attempts of inverse folding.
+ *
+ * @author    Franco Riberi
+ * @email     fgriberi AT gmail.com
+ *
+ * Contents:  Source file.
+ *
+ * System:    fideo: Folding Interface Dynamic Exchange Operations
+ * Language:  C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo.
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstring>
+#include <ctime>
+#include <set>
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
+#include <biopp/biopp.h>
+#include <gtest/gtest.h>
+#include "fideo/RNAStartInverse.h"
+#include "fideo/FideoStructureParser.h"
+
+using namespace fideo;
+
+static const std::string LOCK_DIR = "/tmp/fideo-inverse-lock";
+/** Writes a sequence made from the given shell value, one that differs for each run. */
+static const std::string SEQUENCE_OF = " | sed 's/0/aa/g;s/1/ac/g;s/2/ag/g;s/3/au/g;s/4/ca/g;s/5/cc/g;s/6/cg/g;s/7/cu/g;s/8/ga/g;s/9/gc/g;s/-/uu/g'";
+
+/** Fake backend: runs the given command and reads a sequence from its first line. */
+class FakeInverse : public RNAStartInverse
+{
+public:
+    FakeInverse(const InverseFoldParams& params, const etilico::Command& command)
+        : RNAStartInverse(params), command(command)
+    {}
+
+    virtual void query_start(IStartProvider*) {}
+
+private:
+    virtual void get_command(etilico::Command& cmd, const Temperature /*temp*/) const
+    {
+        cmd = command;
+    }
+
+    virtual void parse_output(ChildProcess& process, Candidates& found) const
+    {
+        Candidate candidate;
+        candidate.hd = 0;
+        candidate.sd = 0;
+        while (process.readLine(candidate.seq))
+        {
+            found.push_back(candidate);
+        }
+        if (found.empty())
+            throw RNABackendException("Could not read output");
+    }
+
+
+    const etilico::Command command;
+};
+
+class RNAStartInverseTest : public ::testing::Test
+{
+protected:
+    biopp::SecStructure structure;
+
+    void SetUp()
+    {
+        ViennaParser::parseStructure("(..((.....))..)", structure);
+        rmdir(LOCK_DIR.c_str());
+    }
+};
+
+TEST_F(RNAStartInverseTest, ParallelAttemptsCancelTheRest)
+{
+    //the first run answers at once with its pid, the others hang.
+    FakeInverse inverse(InverseFoldParams(structure, 0, 5, 10, 4),
+                        "if mkdir " + LOCK_DIR + " 2>/dev/null; then echo $$; else sleep 30; echo $$; fi" + SEQUENCE_OF);
+    IFoldInverse& base = inverse;
+    base.set_start(biopp::NucSequence("GCACGCGTATGCCGC"));
+
+    const time_t begin = time(NULL);
+    biopp::NucSequence seq;
+    base.fold_inverse(seq);
+    EXPECT_LT(time(NULL) - begin, 10);
+    EXPECT_GT(seq.length(), 0u);
+    EXPECT_EQ(0, rmdir(LOCK_DIR.c_str()));
+}
+
+TEST_F(RNAStartInverseTest, ParallelAttemptsAreNovel)
+{
+    FakeInverse inverse(InverseFoldParams(structure, 0, 5, 10, 3), "echo $$" + SEQUENCE_OF);
+    IFoldInverse& base = inverse;
+    base.set_start(biopp::NucSequence("GCACGCGTATGCCGC"));
+
+    std::set<std::string> sequences;
+    for (size_t i = 0; i < 5; ++i)
+    {
+        biopp::NucSequence seq;
+        base.fold_inverse(seq);
+        sequences.insert(seq.getString());
+    }
+    EXPECT_EQ(5u, sequences.size());
+}
+
+TEST_F(RNAStartInverseTest, ParallelAttemptsPropagateErrors)
+{
+    FakeInverse inverse(InverseFoldParams(structure, 0, 5, 10, 3), "exit 1");
+    IFoldInverse& base = inverse;
+    base.set_start(biopp::NucSequence("GCACGCGTATGCCGC"));
+
+    biopp::NucSequence seq;
+    EXPECT_THROW(base.fold_inverse(seq), RNABackendException);
+}
+
+TEST_F(RNAStartInverseTest, DesignsAreBuffered)
+{
+    const std::string runsFile = "/tmp/fideo-inverse-runs";
+    unlink(runsFile.c_str());
+    FakeInverse inverse(InverseFoldParams(structure, 0, 5, 10, 1, 5),
+                        "echo run >> " + runsFile + "; for i in 1 2 3 4 5; do echo $$-$i; done" + SEQUENCE_OF);
+    IFoldInverse& base = inverse;
+    base.set_start(biopp::NucSequence("GCACGCGTATGCCGC"));
+
+    std::set<std::string> sequences;
+    for (size_t i = 0; i < 5; ++i)
+    {
+        biopp::NucSequence seq;
+        base.fold_inverse(seq);
+        sequences.insert(seq.getString());
+    }
+    EXPECT_EQ(5u, sequences.size());
+
+    std::ifstream runs(runsFile.c_str());
+    std::string line;
+    size_t count = 0;
+    while (std::getline(runs, line))
+    {
+        ++count;
+    }
+    EXPECT_EQ(1u, count);
+    unlink(runsFile.c_str());
+}
+
+TEST_F(RNAStartInverseTest, AmbiguousStartIsRejected)
+{
+    FakeInverse inverse(InverseFoldParams(structure, 0, 5, 10), "echo gcacgcguaugccgc");
+    IFoldInverse& base = inverse;
+    EXPECT_THROW(base.set_start(biopp::NucSequence("GCACGCNTATGCCGC")), UnsupportedException);
+    EXPECT_NO_THROW(base.set_start(biopp::NucSequence("GCACGCGTATGCCGC")));
+}
+
+TEST_F(RNAStartInverseTest, AttemptsBudgetIsEnforced)
+{
+    //always yields the start, which is never novel.
+    FakeInverse inverse(InverseFoldParams(structure, 0, 5, 10), "echo gcacgcguaugccgc");
+    IFoldInverse& base = inverse;
+    base.set_start(biopp::NucSequence("GCACGCGTATGCCGC"));
+    base.set_budget(DesignBudget(5));
+
+    biopp::NucSequence seq;
+    EXPECT_THROW(base.fold_inverse(seq), DesignBudgetExhausted);
+}
+
+TEST_F(RNAStartInverseTest, ParallelRunsPayTheirAttempts)
+{
+    const std::string runsFile = "/tmp/fideo-inverse-runs";
+    unlink(runsFile.c_str());
+    FakeInverse inverse(InverseFoldParams(structure, 0, 5, 10, 3), "echo run >> " + runsFile + "; echo gcacgcguaugccgc");
+    IFoldInverse& base = inverse;
+    base.set_start(biopp::NucSequence("GCACGCGTATGCCGC"));
+    base.set_budget(DesignBudget(4));
+
+    biopp::NucSequence seq;
+    EXPECT_THROW(base.fold_inverse(seq), DesignBudgetExhausted);
+
+    std::ifstream runs(runsFile.c_str());
+    std::string line;
+    size_t count = 0;
+    while (std::getline(runs, line))
+    {
+        ++count;
+    }
+    EXPECT_EQ(4u, count);
+    unlink(runsFile.c_str());
+}
+
+TEST_F(RNAStartInverseTest, TimeBudgetIsEnforced)
+{
+    FakeInverse inverse(InverseFoldParams(structure, 0, 5, 10, 2), "sleep 0.1; echo gcacgcguaugccgc");
+    IFoldInverse& base = inverse;
+    base.set_start(biopp::NucSequence("GCACGCGTATGCCGC"));
+    base.set_budget(DesignBudget(0, 0.5));
+
+    const time_t begin = time(NULL);
+    biopp::NucSequence seq;
+    EXPECT_THROW(base.fold_inverse(seq), DesignBudgetExhausted);
+    EXPECT_LT(time(NULL) - begin, 5);
+}
+
+TEST_F(RNAStartInverseTest, NearDesignsAreRejected)
+{
+    //the second line is at distance 1 of the first one.
+    FakeInverse inverse(InverseFoldParams(structure, 0, 5, 10, 1, 3, 0, 2),
+                        "echo aaaaaaaaaaaaaaa; echo aaaaaaaaaaaaaac; echo cccccccccccccca");
+    IFoldInverse& base = inverse;
+    base.set_start(biopp::NucSequence("GCACGCGTATGCCGC"));
+
+    biopp::NucSequence first;
+    biopp::NucSequence second;
+    base.fold_inverse(first);
+    base.fold_inverse(second);
+    EXPECT_EQ("aaaaaaaaaaaaaaa", first.getString());
+    EXPECT_EQ("cccccccccccccca", second.getString());
+}
+
+TEST_F(RNAStartInverseTest, VerificationDropsWrongDesigns)
+{
+    biopp::SecStructure hairpin;
+    ViennaParser::parseStructure("((((....))))", hairpin);
+    //the backend claims both fold into the target, only the second does.
+    FakeInverse inverse(InverseFoldParams(hairpin, 0, 4, 10, 1, 2, 0, 0, true),
+                        "echo aaaaaaaaaaaa; echo ggggaaaacccc");
+    IFoldInverse& base = inverse;
+    base.set_start(biopp::NucSequence("GCGCAAAAGCGC"));
+
+    biopp::NucSequence seq;
+    base.fold_inverse(seq);
+    EXPECT_EQ("ggggaaaacccc", seq.getString());
+}
+
+TEST_F(RNAStartInverseTest, ParallelRejectsAreNotBuffered)
+{
+    biopp::SecStructure hairpin;
+    ViennaParser::parseStructure("((((....))))", hairpin);
+    //the first run answers at once, the other one hangs.
+    FakeInverse inverse(InverseFoldParams(hairpin, 0, 4, 10, 2, 3, 0, 0, true),
+                        "if mkdir " + LOCK_DIR + " 2>/dev/null; then echo aaaaaaaaaaaa; echo ggggaaaacccc; echo uuuuuuuuuuuu; else sleep 30; fi");
+    IFoldInverse& base = inverse;
+    base.set_start(biopp::NucSequence("GCGCAAAAGCGC"));
+
+    biopp::NucSequence seq;
+    base.fold_inverse(seq);
+    EXPECT_EQ("ggggaaaacccc", seq.getString());
+    EXPECT_EQ(0, rmdir(LOCK_DIR.c_str()));
+
+    //buffered candidates are written as text: the one that failed
+    //verification is gone, the one never tried is kept.
+    std::stringstream snapshot;
+    base.save_state(snapshot);
+    EXPECT_EQ(std::string::npos, snapshot.str().find("aaaaaaaaaaaa"));
+    EXPECT_NE(std::string::npos, snapshot.str().find("uuuuuuuuuuuu"));
+}
+
+TEST_F(RNAStartInverseTest, VerificationUsesTemperature)
+{
+    biopp::SecStructure hairpin;
+    ViennaParser::parseStructure("((((....))))", hairpin);
+    FakeInverse inverse(InverseFoldParams(hairpin, 0, 4, 10, 1, 1, 0, 0, true), "echo ggggaaaacccc");
+    IFoldInverse& base = inverse;
+    base.set_start(biopp::NucSequence("GCGCAAAAGCGC"));
+    base.set_budget(DesignBudget(3));
+
+    //the hairpin melts long before 95 grades.
+    biopp::NucSequence seq;
+    EXPECT_THROW(base.fold_inverse(seq, 95), DesignBudgetExhausted);
+}
+
+TEST_F(RNAStartInverseTest, SnapshotResumesDesign)
+{
+    const etilico::Command command = "echo aaaaaaaaaaaaaaa; echo ccccccccccccccc; echo ggggggggggggggg; echo uuuuuuuuuuuuuuu";
+    std::stringstream snapshot;
+    {
+        FakeInverse inverse(InverseFoldParams(structure, 0, 5, 10, 1, 4), command);
+        IFoldInverse& base = inverse;
+        base.set_start(biopp::NucSequence("GCACGCGTATGCCGC"));
+        biopp::NucSequence seq;
+        base.fold_inverse(seq);
+        base.fold_inverse(seq);
+        EXPECT_EQ("ccccccccccccccc", seq.getString());
+        base.save_state(snapshot);
+    }
+
+    FakeInverse inverse(InverseFoldParams(structure, 0, 5, 10, 1, 4), command);
+    IFoldInverse& base = inverse;
+    base.load_state(snapshot);
+    base.set_budget(DesignBudget(3));
+    //the buffered designs come first, then the ones found are not repeated.
+    biopp::NucSequence seq;
+    base.fold_inverse(seq);
+    EXPECT_EQ("ggggggggggggggg", seq.getString());
+    base.fold_inverse(seq);
+    EXPECT_EQ("uuuuuuuuuuuuuuu", seq.getString());
+    EXPECT_THROW(base.fold_inverse(seq), DesignBudgetExhausted);
+}
+
+/**
+ * Overwrites the length written before a string of a snapshot.
+ */
+static void corruptLength(std::string& snapshot, const std::string& str, const uint64_t length)
+{
+    const size_t at = snapshot.find(str);
+    ASSERT_NE(std::string::npos, at);
+    memcpy(&snapshot[at - sizeof(length)], &length, sizeof(length));
+}
+
+TEST_F(RNAStartInverseTest, SnapshotWithWrongLengths)
+{
+    const etilico::Command command = "echo aaaaaaaaaaaaaaa; echo ccccccccccccccc; echo ggggggggggggggg";
+    std::stringstream snapshot;
+    FakeInverse inverse(InverseFoldParams(structure, 0, 5, 10, 1, 3), command);
+    IFoldInverse& base = inverse;
+    base.set_start(biopp::NucSequence("GCACGCGTATGCCGC"));
+    biopp::NucSequence seq;
+    base.fold_inverse(seq);
+    base.save_state(snapshot);
+    const std::string valid = snapshot.str();
+
+    //huge lengths must not be allocated, other lengths not accepted.
+    const uint64_t lengths[] = {uint64_t(1) << 62, 14, 16};
+    const std::string strings[] = {"gcacgcgtatgccgc", "ggggggggggggggg"};
+    for (size_t s = 0; s < 2; ++s)
+    {
+        for (size_t l = 0; l < 3; ++l)
+        {
+            std::string bytes = valid;
+            corruptLength(bytes, strings[s], lengths[l]);
+            std::stringstream corrupt(bytes);
+            FakeInverse loaded(InverseFoldParams(structure, 0, 5, 10, 1, 3), command);
+            IFoldInverse& loadedBase = loaded;
+            EXPECT_THROW(loadedBase.load_state(corrupt), InvalidDesignSnapshot);
+        }
+    }
+}
+
+TEST_F(RNAStartInverseTest, SnapshotOfAnotherTarget)
+{
+    std::stringstream snapshot;
+    FakeInverse inverse(InverseFoldParams(structure, 0, 5, 10), "echo aaaaaaaaaaaaaaa");
+    IFoldInverse& base = inverse;
+    base.set_start(biopp::NucSequence("GCACGCGTATGCCGC"));
+    base.save_state(snapshot);
+
+    biopp::SecStructure other;
+    ViennaParser::parseStructure("((.((.....))..))", other);
+    FakeInverse another(InverseFoldParams(other, 0, 5, 10), "echo aaaaaaaaaaaaaaaa");
+    IFoldInverse& anotherBase = another;
+    EXPECT_THROW(anotherBase.load_state(snapshot), InvalidDesignSnapshot);
+
+    std::stringstream garbage("not a snapshot at all");
+    EXPECT_THROW(base.load_state(garbage), InvalidDesignSnapshot);
+}
@@ -0,0 +1,89 @@
+/*
+ * @file      RNAsuboptTest.cpp
+ * @brief     RNAsuboptTest is a test file to the suboptimal enumeration backend.
+ *
+ * @author    Franco Riberi
+ * @email     fgriberi AT gmail.com
+ *
+ * Contents:  Source file.
+ *
+ * System:    fideo: Folding Interface Dynamic Exchange Operations
+ * Language:  C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo.
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <biopp/biopp.h>
+#include <gtest/gtest.h>
+#include "fideo/ISuboptimalFold.h"
+
+static const std::string SEQUENCE = "GGGGAAACCCCAUAGGGAAACCCUAUGGGCGAAAGCCC";
+
+TEST(RNAsuboptTest, WholeBand)
+{
+    fideo::ISuboptimalFold* const subopt = fideo::ISuboptimalFold::Factory::new_class("RNAsubopt");
+    ASSERT_TRUE(subopt != NULL);
+    EXPECT_NEAR(-19.2, subopt->start(biopp::NucSequence(SEQUENCE), false, 1, 0), 1e-5);
+
+    fideo::Suboptimal suboptimal;
+    std::string dotBracket;
+    size_t count = 0;
+    bool mfeFound = false;
+    while (subopt->next(suboptimal))
+    {
+        ++count;
+        EXPECT_EQ(SEQUENCE.size(), suboptimal.structure.size());
+        EXPECT_LE(suboptimal.energy, -18.2 + 1e-5);
+        EXPECT_GE(suboptimal.energy, -19.2 - 1e-5);
+        suboptimal.structure.toString(dotBracket);
+        mfeFound = mfeFound || dotBracket == "(((....((((((((((...))))))))).)....)))";
+    }
+    EXPECT_EQ(5u, count);
+    EXPECT_TRUE(mfeFound);
+    EXPECT_FALSE(subopt->next(suboptimal));
+    delete subopt;
+}
+
+TEST(RNAsuboptTest, EarlyStop)
+{
+    fideo::ISuboptimalFold* const subopt = fideo::ISuboptimalFold::Factory::new_class("RNAsubopt");
+    //a band too wide to enumerate: only the structures read are paid.
+    std::string longSequence;
+    for (size_t i = 0; i < 10; ++i)
+    {
+        longSequence += "GGGAAUCCCGAUACGCUAGCAAAUUCGCG";
+    }
+    const biopp::NucSequence sequence(longSequence);
+    subopt->start(sequence, false, 30, 3);
+    fideo::Suboptimal suboptimal;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(subopt->next(suboptimal));
+    }
+    EXPECT_FALSE(subopt->next(suboptimal));
+
+    //stopped by the caller, then started again.
+    subopt->start(sequence, false, 30, 0);
+    EXPECT_TRUE(subopt->next(suboptimal));
+    subopt->stop();
+    EXPECT_FALSE(subopt->next(suboptimal));
+    delete subopt;
+}
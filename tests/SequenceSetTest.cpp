@@ -0,0 +1,113 @@
+/*
+ * @file      SequenceSetTest.cpp
+ * @brief     SequenceSetTest is a test file to the packed sequences and their hashed set.
+ *
+ * @author    Franco Riberi
+ * @email     fgriberi AT gmail.com
+ *
+ * Contents:  Source file.
+ *
+ * System:    fideo: Folding Interface Dynamic Exchange Operations
+ * Language:  C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo.
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <set>
+#include <sstream>
+#include <gtest/gtest.h>
+#include "fideo/SequenceSet.h"
+
+using namespace fideo;
+
+TEST(SequenceSetTestSuite, PackUnpack)
+{
+    const std::string sequence = "ACGUACGUUUGGCCAAacguacgtacguacguacguACGUacgu";
+    PackedSequence packed(sequence);
+    EXPECT_EQ(sequence.size(), packed.size());
+    EXPECT_EQ(2u, packed.words().size());
+    std::string unpacked;
+    packed.unpack(unpacked);
+    EXPECT_EQ("acguacguuuggccaaacguacguacguacguacguacguacgu", unpacked);
+    EXPECT_TRUE(PackedSequence("acgt") == PackedSequence("ACGU"));
+    EXPECT_FALSE(PackedSequence("acg") == PackedSequence("acga"));
+    EXPECT_THROW(PackedSequence("acgn"), UnsupportedException);
+}
+
+TEST(SequenceSetTestSuite, InsertContains)
+{
+    SequenceSet set;
+    EXPECT_TRUE(set.insert("gcacgcguaugccgc"));
+    EXPECT_FALSE(set.insert("GCACGCGTATGCCGC"));
+    EXPECT_TRUE(set.insert("gcacgcguaugccg"));
+    EXPECT_TRUE(set.contains("gcacgcguaugccgc"));
+    EXPECT_FALSE(set.contains("gcacgcguaugccga"));
+    EXPECT_FALSE(set.contains(""));
+    EXPECT_EQ(2u, set.size());
+    set.clear();
+    EXPECT_EQ(0u, set.size());
+    EXPECT_FALSE(set.contains("gcacgcguaugccgc"));
+}
+
+static void makeSequence(size_t value, const size_t length, std::string& sequence)
+{
+    static const char BASES[] = "acgu";
+    sequence.resize(length);
+    for (size_t i = 0; i < length; ++i)
+    {
+        sequence[i] = BASES[value % 4];
+        value /= 4;
+    }
+}
+
+struct CountSequences
+{
+    CountSequences() : count(0) {}
+    void operator()(const PackedSequence& sequence)
+    {
+        EXPECT_EQ(40u, sequence.size());
+        ++count;
+    }
+    size_t count;
+};
+
+TEST(SequenceSetTestSuite, ManySequencesWithBloom)
+{
+    static const size_t SEQUENCES = 20000;
+    SequenceSet set(SEQUENCES / 4, 10);
+    std::string sequence;
+    for (size_t i = 0; i < SEQUENCES; ++i)
+    {
+        makeSequence(i * 7919, 40, sequence);
+        EXPECT_TRUE(set.insert(sequence));
+    }
+    EXPECT_EQ(SEQUENCES, set.size());
+    for (size_t i = 0; i < SEQUENCES; ++i)
+    {
+        makeSequence(i * 7919, 40, sequence);
+        EXPECT_TRUE(set.contains(sequence));
+        makeSequence(i * 7919 + 1, 40, sequence);
+        EXPECT_FALSE(set.contains(sequence));
+    }
+    CountSequences counter;
+    set.forEach(counter);
+    EXPECT_EQ(SEQUENCES, counter.count);
+}
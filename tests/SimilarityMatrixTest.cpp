@@ -0,0 +1,197 @@
+/*
+ * @file      SimilarityMatrixTest.cpp
+ * @brief     All-vs-all similarity matrix tests.
+ *
+ * @author    Franco Riberi
+ * @email     fgriberi AT gmail.com
+ *
+ * Contents:  Source file.
+ *
+ * System:    fideo: Folding Interface Dynamic Exchange Operations
+ * Language:  C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo.
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <biopp/biopp.h>
+#include <gtest/gtest.h>
+#include "fideo/SimilarityMatrix.h"
+#include "fideo/IStructureCmp.h"
+#include "fideo/FideoStructureParser.h"
+#include "fideo/RnaBackendsException.h"
+
+using namespace fideo;
+
+static void structuresOf(const char* const dotBrackets[], const size_t n, std::vector<biopp::SecStructure>& structures)
+{
+    structures.resize(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        ViennaParser::parseStructure(dotBrackets[i], structures[i]);
+    }
+}
+
+static const char* const STRUCTURES[] =
+{
+    "((..((...))..))",
+    "(...((...))...)",
+    "...............",
+    "(((.......)))..",
+    "((((.....))))..",
+    "..((.......))..",
+    ".(((.....)))...",
+    "((.((...)).))..",
+    "(.............)"
+};
+static const size_t N = sizeof(STRUCTURES) / sizeof(STRUCTURES[0]);
+
+static void expectAllPairs(const std::vector<biopp::SecStructure>& structures, const Similitude* upper)
+{
+    std::unique_ptr<IStructureCmp> cmp(IStructureCmp::Factory::new_class("BasePairDistance"));
+    for (size_t i = 0; i < structures.size(); ++i)
+    {
+        for (size_t j = i + 1; j < structures.size(); ++j)
+        {
+            EXPECT_EQ(cmp->compare(structures[i], structures[j]), upper[SimilarityMatrix::index(i, j, structures.size())]);
+        }
+    }
+}
+
+TEST(SimilarityMatrixTest, Layout)
+{
+    EXPECT_EQ(0u, SimilarityMatrix::entries(0));
+    EXPECT_EQ(0u, SimilarityMatrix::entries(1));
+    EXPECT_EQ(6u, SimilarityMatrix::entries(4));
+    EXPECT_EQ(0u, SimilarityMatrix::index(0, 1, 4));
+    EXPECT_EQ(2u, SimilarityMatrix::index(0, 3, 4));
+    EXPECT_EQ(3u, SimilarityMatrix::index(1, 2, 4));
+    EXPECT_EQ(5u, SimilarityMatrix::index(2, 3, 4));
+}
+
+TEST(SimilarityMatrixTest, AllPairsInTiles)
+{
+    std::vector<biopp::SecStructure> structures;
+    structuresOf(STRUCTURES, N, structures);
+
+    //tiles of 2 structures leave a partial tile at the end.
+    const SimilarityMatrix matrix("BasePairDistance", 3, 2);
+    std::vector<Similitude> upper;
+    matrix.compute(structures, upper);
+
+    ASSERT_EQ(SimilarityMatrix::entries(N), upper.size());
+    expectAllPairs(structures, upper.data());
+}
+
+TEST(SimilarityMatrixTest, MappedFile)
+{
+    std::vector<biopp::SecStructure> structures;
+    structuresOf(STRUCTURES, N, structures);
+    const FilePath path = "similarity.matrix";
+
+    const SimilarityMatrix matrix("BasePairDistance", 2, 4);
+    matrix.compute(structures, path);
+
+    std::vector<Similitude> upper(SimilarityMatrix::entries(N) + 1);
+    std::ifstream in(path.c_str(), std::ios::binary);
+    in.read(reinterpret_cast<char*>(upper.data()), upper.size() * sizeof(Similitude));
+    EXPECT_EQ(std::streamsize(SimilarityMatrix::entries(N) * sizeof(Similitude)), in.gcount());
+    expectAllPairs(structures, upper.data());
+    remove(path.c_str());
+}
+
+TEST(SimilarityMatrixTest, SameLayoutAsCompareAll)
+{
+    std::vector<biopp::SecStructure> structures;
+    structuresOf(STRUCTURES, N, structures);
+    std::unique_ptr<IStructureCmp> cmp(IStructureCmp::Factory::new_class("BasePairOverlap"));
+
+    std::vector<Similitude> expected;
+    cmp->compareAll(structures, expected);
+    std::vector<Similitude> upper;
+    SimilarityMatrix("BasePairOverlap", 2, 4).compute(structures, upper);
+    EXPECT_EQ(expected, upper);
+}
+
+TEST(SimilarityMatrixTest, ConcurrentExternalComparator)
+{
+    //RNAforester cannot read structures without pairs.
+    static const char* const PAIRED[] =
+    {
+        "((..((...))..))",
+        "(...((...))...)",
+        "(((.......)))..",
+        "((((.....))))..",
+        "..((.......))..",
+        ".(((.....)))...",
+        "((.((...)).))..",
+        "(.............)"
+    };
+    std::vector<biopp::SecStructure> structures;
+    structuresOf(PAIRED, sizeof(PAIRED) / sizeof(PAIRED[0]), structures);
+    std::unique_ptr<IStructureCmp> cmp(IStructureCmp::Factory::new_class("RNAForester"));
+
+    std::vector<Similitude> upper;
+    SimilarityMatrix("RNAForester", 4, 2).compute(structures, upper);
+    ASSERT_EQ(SimilarityMatrix::entries(structures.size()), upper.size());
+    for (size_t i = 0; i < structures.size(); ++i)
+    {
+        for (size_t j = i + 1; j < structures.size(); ++j)
+        {
+            EXPECT_EQ(cmp->compare(structures[i], structures[j]), upper[SimilarityMatrix::index(i, j, structures.size())]);
+        }
+    }
+}
+
+TEST(SimilarityMatrixTest, FewStructures)
+{
+    std::vector<biopp::SecStructure> structures;
+    structuresOf(STRUCTURES, 1, structures);
+    std::vector<Similitude> upper(3);
+
+    const SimilarityMatrix matrix("BasePairDistance", 4);
+    matrix.compute(structures, upper);
+    EXPECT_TRUE(upper.empty());
+}
+
+TEST(SimilarityMatrixTest, UnknownComparator)
+{
+    std::vector<biopp::SecStructure> structures;
+    structuresOf(STRUCTURES, N, structures);
+    std::vector<Similitude> upper;
+
+    const SimilarityMatrix matrix("NotAComparator", 2);
+    EXPECT_THROW(matrix.compute(structures, upper), InvalidDerived);
+}
+
+TEST(SimilarityMatrixTest, ComparatorFailure)
+{
+    std::vector<biopp::SecStructure> structures;
+    structuresOf(STRUCTURES, N, structures);
+    structures.push_back(biopp::SecStructure());
+    std::vector<Similitude> upper;
+
+    //tree alignment rejects empty structures.
+    const SimilarityMatrix matrix("TreeAlignment", 2, 3);
+    EXPECT_THROW(matrix.compute(structures, upper), InvalidStructureException);
+}
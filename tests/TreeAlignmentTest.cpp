@@ -0,0 +1,86 @@
+/*
+ * @file      TreeAlignmentTest.cpp
+ * @brief     In-process tree alignment tests.
+ *
+ * @author    Franco Riberi
+ * @email     fgriberi AT gmail.com
+ *
+ * Contents:  Source file.
+ *
+ * System:    fideo: Folding Interface Dynamic Exchange Operations
+ * Language:  C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo.
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <memory>
+#include <biopp/biopp.h>
+#include <gtest/gtest.h>
+#include "fideo/IStructureCmp.h"
+#include "fideo/FideoStructureParser.h"
+#include "fideo/RnaBackendsException.h"
+
+using namespace fideo;
+
+static Similitude compare(const IStructureCmp& cmp, const std::string& first, const std::string& second)
+{
+    biopp::SecStructure s1;
+    biopp::SecStructure s2;
+    ViennaParser::parseStructure(first, s1);
+    ViennaParser::parseStructure(second, s2);
+    return cmp.compare(s1, s2);
+}
+
+TEST(TreeAlignmentTest, SameScoresAsRNAforester)
+{
+    std::unique_ptr<IStructureCmp> cmp(IStructureCmp::Factory::new_class("TreeAlignment"));
+
+    EXPECT_FLOAT_EQ(-1.4f, compare(*cmp, "((....))", "(...)..."));
+    EXPECT_NEAR(-1.31034, compare(*cmp, "((..((...))..))", "(((....)))......"), 1e-5);
+    EXPECT_FLOAT_EQ(-1.0f, compare(*cmp, "(((...)))..(((...)))", "..((((....))))......"));
+}
+
+TEST(TreeAlignmentTest, IdenticalStructures)
+{
+    std::unique_ptr<IStructureCmp> cmp(IStructureCmp::Factory::new_class("TreeAlignment"));
+
+    EXPECT_FLOAT_EQ(1.0f, compare(*cmp, "((..((...))..))", "((..((...))..))"));
+    EXPECT_FLOAT_EQ(1.0f, compare(*cmp, "......", "......"));
+}
+
+TEST(TreeAlignmentTest, ReusedBetweenCalls)
+{
+    std::unique_ptr<IStructureCmp> cmp(IStructureCmp::Factory::new_class("TreeAlignment"));
+
+    const Similitude first = compare(*cmp, "((..((...))..))", "(((....)))......");
+    compare(*cmp, "(((...)))..(((...)))..(((...)))", "..");
+    EXPECT_EQ(first, compare(*cmp, "((..((...))..))", "(((....)))......"));
+}
+
+TEST(TreeAlignmentTest, EmptyStructure)
+{
+    std::unique_ptr<IStructureCmp> cmp(IStructureCmp::Factory::new_class("TreeAlignment"));
+    biopp::SecStructure empty;
+    biopp::SecStructure other;
+    ViennaParser::parseStructure("(...)", other);
+
+    EXPECT_THROW(cmp->compare(empty, other), InvalidStructureException);
+}
@@ -129,6 +129,20 @@ TEST(UnaFoldBackendTestSuite1, FoldFromTest)
     EXPECT_FALSE(HelperTest::checkDirTmp());
 }
 
+TEST(UnaFoldBackendTestSuite1, FoldEnergyTest)
+{
+    const biopp::NucSequence seq("AAAAAAAAGGGGGGGGCCCCCCCCTTTTTTTT");
+    biopp::SecStructure secStructure;
+
+    IFold* const p = Fold::new_class("UNAFold");
+    ASSERT_TRUE(p != NULL);
+
+    const Fe expected = p->fold(seq, false, secStructure);
+    EXPECT_DOUBLE_EQ(expected, p->foldEnergy(seq, false));
+    delete p;
+    EXPECT_FALSE(HelperTest::checkDirTmp());
+}
+
 TEST(UnaFoldBackendTestSuite1, InvalidBackend)
 {
     IFold* const unafold = Fold::new_class("UNAFOLD");    
@@ -182,6 +196,25 @@ TEST(UnaFoldBackendTestSuite2, correctCommad2)
     EXPECT_FALSE(HelperTest::checkDirTmp());
 }
 
+TEST(UnaFoldBackendTestSuite2, correctEnergyCommand)
+{
+    const biopp::NucSequence seq("AAAAAAAAGGGGGGGGCCCCCCCCTTTTTTTT");
+    IFoldIntermediate *unafold = new UNAFold();
+    InputFile inFile;
+    OutputFile outFile;
+    etilico::Command cmd;
+    unafold->prepareEnergyData(seq, true, cmd, inFile, outFile);
+
+    EXPECT_TRUE(HelperTest::checkDirTmp());
+    std::stringstream cmdExpected;
+    cmdExpected << "hybrid-ss-min --quiet --NA=RNA --circular --tmin=37 --tmax=37 ";
+    cmdExpected << seq.getString() << " > " << outFile;
+    EXPECT_EQ(cmdExpected.str(), cmd);
+    unafold->deleteFilesAfterEnergy(inFile, outFile);
+    delete unafold;
+    EXPECT_FALSE(HelperTest::checkDirTmp());
+}
+
 static const size_t COMMAND_NOT_FOUND = 127;
 
 TEST(UnaFoldBackendTestSuite2, incorrectCommad)
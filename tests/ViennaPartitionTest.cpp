@@ -0,0 +1,76 @@
+/*
+ * @file      ViennaPartitionTest.cpp
+ * @brief     ViennaPartitionTest is a test file to the partition function backend.
+ *
+ * @author    Franco Riberi
+ * @email     fgriberi AT gmail.com
+ *
+ * Contents:  Source file.
+ *
+ * System:    fideo: Folding Interface Dynamic Exchange Operations
+ * Language:  C++
+ *
+ * @date October 2026
+ *
+ * Copyright (C) 2026 Franco Riberi, FuDePAN
+ *
+ * This file is part of fideo.
+ *
+ * fideo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * fideo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with fideo. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <biopp/biopp.h>
+#include <gtest/gtest.h>
+#include "fideo/IPartitionFunction.h"
+#include "fideo/RnaBackendsException.h"
+
+static const std::string SEQUENCE = "GGGGAAACCCCAUAGGGAAACCCUAUGGGCGAAAGCCC";
+
+TEST(ViennaPartitionTest, EnsembleEnergy)
+{
+    fideo::IPartitionFunction* const partition = fideo::IPartitionFunction::Factory::new_class("ViennaPartition");
+    ASSERT_TRUE(partition != NULL);
+    const biopp::NucSequence sequence(SEQUENCE);
+    //as RNAfold -p reports it.
+    EXPECT_NEAR(-19.86, partition->ensembleEnergy(sequence, false), 0.005);
+    //the helices still hold at 50 grades.
+    EXPECT_LE(partition->ensembleEnergy(sequence, false, 50), -10.0);
+    EXPECT_THROW(partition->ensembleEnergy(biopp::NucSequence(""), false), fideo::RNABackendException);
+    delete partition;
+}
+
+TEST(ViennaPartitionTest, PairProbabilities)
+{
+    fideo::IPartitionFunction* const partition = fideo::IPartitionFunction::Factory::new_class("ViennaPartition");
+    const biopp::NucSequence sequence(SEQUENCE);
+    std::vector<fideo::PairProbability> pairs;
+    EXPECT_NEAR(-19.86, partition->pairProbabilities(sequence, false, 0.5, pairs), 0.005);
+
+    //the pairs of the dot plot of RNAfold -p above 0.5.
+    const unsigned int first[] = {0, 1, 2, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+    const unsigned int second[] = {37, 36, 35, 30, 28, 27, 26, 25, 24, 23, 22, 21, 20};
+    ASSERT_EQ(13u, pairs.size());
+    for (size_t i = 0; i < pairs.size(); ++i)
+    {
+        EXPECT_EQ(first[i], pairs[i].first);
+        EXPECT_EQ(second[i], pairs[i].second);
+    }
+    EXPECT_NEAR(0.540601, pairs[0].probability, 1e-4);
+    EXPECT_NEAR(0.997142, pairs[10].probability, 1e-4);
+
+    partition->pairProbabilities(sequence, false, 0.01, pairs);
+    EXPECT_EQ(27u, pairs.size());
+    delete partition;
+}